@@ -0,0 +1,148 @@
+// Measures WordStorage::load() against dictionary size, next to the
+// quadratic duplicate check it replaced. Each size is then loaded again from
+// its snapshot in a fresh process, which reports its resident memory once
+// loaded and again after building the text, relation and translation
+// indexes from every decoded entry, as loading did before the snapshot
+// stored them.
+//
+// Build with -DDEEPLINGO_BUILD_BENCHMARKS=ON and run DeepLingo_LoadBenchmark.
+
+#include "Word_Files/Word_Storage.h"
+#include "Benchmark_Files/Synthetic_Data.h"
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QTemporaryDir>
+#include <QJsonDocument>
+#include <QFile>
+#include <QProcess>
+#include <cstdio>
+#if defined(Q_OS_WIN)
+#include <windows.h>
+#include <psapi.h>
+#endif
+
+// Resident memory of this process in KiB, or -1 where it cannot be read.
+static qint64 residentKiB()
+{
+#if defined(Q_OS_WIN)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return -1;
+    return qint64(counters.WorkingSetSize / 1024);
+#elif defined(Q_OS_LINUX)
+    QFile f("/proc/self/status");
+    if (!f.open(QIODevice::ReadOnly | QIODevice::Text)) return -1;
+    while (!f.atEnd()) {
+        const QByteArray line = f.readLine();
+        if (line.startsWith("VmRSS:")) return line.mid(6).trimmed().split(' ').first().toLongLong();
+    }
+    return -1;
+#else
+    return -1;
+#endif
+}
+
+// Run as "--resident <path>" in a fresh process, once the snapshot of <path>
+// is current. Prints the load time in ms and the resident KiB after loading
+// and after indexing the decoded entries in memory.
+static int reportResident(const QString &path)
+{
+    WordStorage &storage = WordStorage::instance();
+    QElapsedTimer t;
+    t.start();
+    storage.load(path);
+    const qint64 loadMs = t.elapsed();
+    const qint64 loaded = residentKiB();
+
+    QHash<QString, int> wordIndex;
+    for (int id = 0; id < storage.size(); ++id) {
+        const QString key = WordStorage::foldKey(storage.word(id));
+        if (!wordIndex.contains(key)) wordIndex.insert(key, id);
+    }
+    TextIndex text;
+    RelationIndex relations;
+    TranslationIndex translations;
+    for (int id = 0; id < storage.size(); ++id) {
+        const WordEntry e = storage.entry(id);
+        text.add(id, e);
+        relations.add(id, e, wordIndex);
+        translations.add(id, e);
+    }
+    const qint64 decoded = residentKiB();
+
+    std::printf("%lld %lld %lld\n", static_cast<long long>(loadMs), static_cast<long long>(loaded),
+                static_cast<long long>(decoded));
+    return 0;
+}
+
+static QString mebibytes(const QByteArray &kib)
+{
+    const qint64 value = kib.toLongLong();
+    return value < 0 ? QString("-") : QString::number(value / 1024.0, 'f', 1);
+}
+
+// The load path before the key-set change: DOM parse, then a
+// case-insensitive scan of every stored entry for each file entry.
+static int legacyLoad(const QString &path)
+{
+    QFile f(path);
+    if (!f.open(QIODevice::ReadOnly)) return 0;
+    const QJsonArray arr = QJsonDocument::fromJson(f.readAll()).array();
+
+    QVector<WordEntry> words;
+    for (const auto &v : arr) {
+        WordEntry entry = WordEntry::fromJson(v.toObject());
+        bool exists = false;
+        for (const auto &w : words) {
+            if (w.word.compare(entry.word, Qt::CaseInsensitive) == 0) {
+                exists = true;
+                break;
+            }
+        }
+        if (!exists) words.append(entry);
+    }
+    return words.size();
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    if (argc == 3 && QByteArray(argv[1]) == "--resident") return reportResident(QString::fromLocal8Bit(argv[2]));
+
+    QTemporaryDir dir;
+    if (!dir.isValid()) return 1;
+
+    // The quadratic path takes minutes past this size, so it is skipped there.
+    const int LEGACY_LIMIT = 20000;
+    const int sizes[] = {1000, 5000, 10000, 20000, 50000, 100000};
+
+    std::printf("%10s %14s %14s %14s %14s %14s\n", "entries", "before (ms)", "after (ms)",
+                "mapped (ms)", "mapped (MiB)", "decoded (MiB)");
+    for (int n : sizes) {
+        const QString path = writeDictionary(dir.path(), n);
+
+        QString before = "-";
+        if (n <= LEGACY_LIMIT) {
+            QElapsedTimer t;
+            t.start();
+            legacyLoad(path);
+            before = QString::number(t.elapsed());
+        }
+
+        QElapsedTimer t;
+        t.start();
+        WordStorage::instance().load(path);
+        const qint64 after = t.elapsed();
+
+        // load() has converted the file; map its snapshot in a clean process.
+        QProcess child;
+        child.start(QCoreApplication::applicationFilePath(), { "--resident", path });
+        child.waitForFinished(-1);
+        QList<QByteArray> resident = child.readAllStandardOutput().trimmed().split(' ');
+        if (resident.size() != 3) resident = { "-1", "-1", "-1" };
+
+        const QString mappedMs = resident.at(0).toLongLong() < 0 ? QString("-") : QString(resident.at(0));
+        std::printf("%10d %14s %14lld %14s %14s %14s\n", n, qPrintable(before), static_cast<long long>(after),
+                    qPrintable(mappedMs), qPrintable(mebibytes(resident.at(1))), qPrintable(mebibytes(resident.at(2))));
+    }
+    return 0;
+}
@@ -0,0 +1,97 @@
+// Checks that the per-operation cost of the dictionary stays flat as it
+// grows: add, exact lookup, browse and save are timed at 10k, 100k and 1M
+// entries against fixed latency budgets. Exits non-zero if any is exceeded.
+//
+// Build with -DDEEPLINGO_BUILD_BENCHMARKS=ON and run DeepLingo_ScaleBenchmark.
+// Pass a smaller maximum size as the first argument for a quick run.
+
+#include "Word_Files/Word_Storage.h"
+#include "Function_Files/PersistenceWorker.h"
+#include "Benchmark_Files/Synthetic_Data.h"
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QTemporaryDir>
+#include <cstdio>
+
+namespace {
+// Budgets per operation, in microseconds. save() is measured on the calling
+// thread only: the write itself runs on the persistence thread.
+const double ADD_BUDGET_US = 1000;
+const double LOOKUP_BUDGET_US = 20;
+const double BROWSE_BUDGET_US = 5000; // one page of BROWSE_PAGE rows
+const double SAVE_BUDGET_US = 5000;
+
+const int ADDS = 1000;
+const int LOOKUPS = 20000;
+const int BROWSE_PAGE = 100;
+
+bool report(const char *name, int entries, double us, double budget)
+{
+    const bool ok = us <= budget;
+    std::printf("%10d %-8s %12.1f %12.1f  %s\n", entries, name, us, budget, ok ? "ok" : "OVER");
+    return ok;
+}
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QTemporaryDir dir;
+    if (!dir.isValid()) return 1;
+
+    const int maxSize = argc > 1 ? QString(argv[1]).toInt() : 1000000;
+    const int sizes[] = {10000, 100000, 1000000};
+
+    WordStorage &storage = WordStorage::instance();
+    bool allOk = true;
+
+    std::printf("%10s %-8s %12s %12s\n", "entries", "op", "us/op", "budget");
+    for (int n : sizes) {
+        if (n > maxSize) break;
+        const QString path = writeDictionary(dir.path(), n);
+
+        QElapsedTimer load;
+        load.start();
+        storage.load(path);
+        std::printf("%10d %-8s %12.1f %12s\n", n, "load", load.nsecsElapsed() / 1000.0, "-");
+
+        // Add: the GUI path, an indexed insert plus a journal append.
+        QElapsedTimer t;
+        t.start();
+        for (int i = 0; i < ADDS; ++i) {
+            const WordEntry e = syntheticEntry(n + i);
+            storage.addWord(e);
+            storage.appendToJournal(e);
+        }
+        allOk &= report("add", n, t.nsecsElapsed() / 1000.0 / ADDS, ADD_BUDGET_US);
+
+        t.restart();
+        int found = 0;
+        for (int i = 0; i < LOOKUPS; ++i) found += storage.find(syntheticWord((i * 7919) % n)) >= 0;
+        allOk &= report("lookup", n, t.nsecsElapsed() / 1000.0 / LOOKUPS, LOOKUP_BUDGET_US);
+        if (found != LOOKUPS) std::printf("  lookup missed %d words\n", LOOKUPS - found);
+
+        // Browse: what a view needs to show the first page of one letter.
+        t.restart();
+        int rows = 0;
+        for (QChar letter = 'a'; letter <= 'z'; letter = QChar(letter.unicode() + 1)) {
+            const QVector<int> &ids = storage.idsForLetter(letter);
+            for (int k = 0; k < qMin(BROWSE_PAGE, int(ids.size())); ++k) {
+                rows += storage.word(ids.at(k)).size() + storage.definition(ids.at(k)).size() > 0;
+            }
+        }
+        allOk &= report("browse", n, t.nsecsElapsed() / 1000.0 / 26, BROWSE_BUDGET_US);
+
+        t.restart();
+        storage.save();
+        allOk &= report("save", n, t.nsecsElapsed() / 1000.0, SAVE_BUDGET_US);
+
+        t.restart();
+        PersistenceWorker::instance().flush();
+        std::printf("%10d %-8s %12.1f %12s\n", n, "write", t.nsecsElapsed() / 1000.0, "-");
+    }
+
+    PersistenceWorker::instance().shutdown();
+    return allOk ? 0 : 1;
+}
@@ -0,0 +1,49 @@
+#ifndef SYNTHETIC_DATA_H
+#define SYNTHETIC_DATA_H
+
+// Generated dictionaries shared by the storage benchmarks.
+
+#include "Word_Files/Word_Storage.h"
+#include <QJsonDocument>
+#include <QFile>
+
+// Unique, letter-only word for index i, spread evenly over the 26 initials.
+inline QString syntheticWord(int i)
+{
+    QString w(QChar('a' + i % 26));
+    for (int n = i / 26; n > 0; n /= 26) w.append(QChar('a' + n % 26));
+    return w + "word";
+}
+
+// Entry i, with every field filled and links to the next few words.
+inline WordEntry syntheticEntry(int i)
+{
+    WordEntry e;
+    e.word = syntheticWord(i);
+    e.definition = QString("Definition number %1 for %2.").arg(i).arg(e.word);
+    e.synonyms = {syntheticWord(i + 1), syntheticWord(i + 2)};
+    e.antonyms = {syntheticWord(i + 3)};
+    e.background = "Synthetic entry generated by a storage benchmark.";
+    e.usage = QString("Use %1 in a sentence.").arg(e.word);
+    e.translation = QString("Salita %1\nKasingkahulugan: halimbawa, subok").arg(i);
+    return e;
+}
+
+// Writes <dir>/words_<count>.json with entries 0 to count - 1, one element
+// at a time so the generator never holds the whole document. Returns the
+// path, or an empty string if the file cannot be created.
+inline QString writeDictionary(const QString &dir, int count)
+{
+    const QString path = QString("%1/words_%2.json").arg(dir).arg(count);
+    QFile f(path);
+    if (!f.open(QIODevice::WriteOnly)) return QString();
+    f.write("[");
+    for (int i = 0; i < count; ++i) {
+        if (i > 0) f.write(",");
+        f.write(QJsonDocument(syntheticEntry(i).toJson()).toJson(QJsonDocument::Compact));
+    }
+    f.write("]");
+    return path;
+}
+
+#endif // SYNTHETIC_DATA_H
@@ -0,0 +1,46 @@
+#include "Function_Files/DataLoader.h"
+#include "User_Files/UserStorage.h"
+#include "Word_Files/Word_Storage.h"
+#include <QThread>
+
+namespace {
+// Share of the bar for the user index; the dictionary fills the rest.
+const int USERS_PERCENT = 5;
+}
+
+DataLoader::DataLoader(QObject *parent)
+    : QObject(parent)
+{
+}
+
+DataLoader::~DataLoader()
+{
+    if (m_thread) m_thread->wait();
+}
+
+void DataLoader::start(const QString &usersPath, const QString &wordsPath)
+{
+    if (m_thread) return;
+
+    m_thread = QThread::create([this, usersPath, wordsPath]() {
+        // Load existing users. If a previous user was saved, they will be set
+        // as the current user here.
+        bool ok = UserStorage::instance().load(usersPath);
+        emit progress(USERS_PERCENT);
+
+        int last = USERS_PERCENT;
+        ok = WordStorage::instance().load(wordsPath, [this, &last](qint64 done, qint64 total) {
+            if (total <= 0) return;
+            const int percent = USERS_PERCENT + int(done * (100 - USERS_PERCENT) / total);
+            if (percent == last) return;
+            last = percent;
+            emit progress(percent);
+        }) && ok;
+        if (last != 100) emit progress(100);
+        m_ok = ok;
+    });
+    m_thread->setObjectName("DataLoader");
+    m_thread->setParent(this);
+    connect(m_thread, &QThread::finished, this, [this]() { emit finished(m_ok); });
+    m_thread->start();
+}
@@ -0,0 +1,34 @@
+#ifndef DATALOADER_H
+#define DATALOADER_H
+
+#include <QObject>
+#include <QString>
+
+class QThread;
+
+// Loads the user index and the dictionary on a background thread at startup,
+// so the loading screen reflects real work instead of a fixed delay.
+//
+// UserStorage and WordStorage are only touched by the loader thread until
+// finished() is emitted; after that they belong to the GUI thread again.
+class DataLoader : public QObject {
+    Q_OBJECT
+public:
+    explicit DataLoader(QObject *parent = nullptr);
+    ~DataLoader();
+
+    void start(const QString &usersPath, const QString &wordsPath);
+
+signals:
+    // Overall progress in percent; emitted on the loader thread, only when
+    // the value changes.
+    void progress(int percent);
+    // Emitted on this object's thread once both stores are loaded.
+    void finished(bool ok);
+
+private:
+    QThread *m_thread = nullptr;
+    bool m_ok = false;
+};
+
+#endif // DATALOADER_H
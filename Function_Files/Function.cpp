@@ -11,51 +11,99 @@ QChar Function::normalizeKey(const QString &word) const {
 }
 
 int Function::addWord(const QString &word, const QString &definition, const QString &translation) {
-    if (word.trimmed().isEmpty() || definition.trimmed().isEmpty()) return 1;
-    QChar key = normalizeKey(word);
+    const QString w = word.trimmed();
+    if (w.isEmpty() || definition.trimmed().isEmpty()) return 1;
+    QChar key = normalizeKey(w);
     if (key == QChar('\0')) return 1;
 
-    auto list = WordStorage::instance().wordsForLetter(key);
-    for (const auto &e : list) {
-        if (e.word.compare(word, Qt::CaseInsensitive) == 0) return 3; // duplicate
-    }
+    WordStorage &storage = WordStorage::instance();
+    if (storage.find(w) >= 0) return 3; // duplicate
 
-    const int MAX_PER_LETTER = 30;
-    if (list.size() >= MAX_PER_LETTER) return 2;
+    if (m_maxPerLetter > 0 && storage.idsForLetter(key).size() >= m_maxPerLetter) return 2;
 
     WordEntry entry;
-    entry.word = word.trimmed();
+    entry.word = w;
     entry.definition = definition.trimmed();
     entry.translation = translation.trimmed();
-    WordStorage::instance().addWord(entry);
-    WordStorage::instance().save();
+    if (!storage.addWord(entry)) return 3; // duplicate
+    storage.appendToJournal(entry);
     return 0;
 }
 
 QString Function::searchWord(const QString &word, bool getTranslation) const {
     if (word.trimmed().isEmpty()) return QString();
-    auto all = WordStorage::instance().allWords();
-    for (const auto &e : all) {
-        if (e.word.compare(word, Qt::CaseInsensitive) == 0) {
-            return getTranslation ? e.translation : e.definition;
-        }
-    }
-    return QString();
+    const WordStorage &storage = store();
+    int id = storage.find(word);
+    if (id < 0) return QString();
+    if (!getTranslation) return storage.definition(id);
+    return storage.entry(id).translation;
 }
 
 QVector<QPair<QString, QString>> Function::getWordsByLetter(QChar letter, bool getTranslation) const {
     QVector<QPair<QString, QString>> out;
-    auto list = WordStorage::instance().wordsForLetter(letter);
-    out.reserve(list.size());
-    for (const auto &e : list) {
-        out.append(qMakePair(e.word, getTranslation ? e.translation : e.definition));
+    const WordStorage &storage = store();
+    const QVector<int> &ids = storage.idsForLetter(letter);
+    out.reserve(ids.size());
+    for (int id : ids) {
+        out.append(qMakePair(storage.word(id), getTranslation ? storage.entry(id).translation : storage.definition(id)));
+    }
+    return out;
+}
+
+QStringList Function::completePrefix(const QString &prefix, int limit) const {
+    QStringList out;
+    const QString p = prefix.trimmed();
+    if (p.isEmpty()) return out;
+
+    const WordStorage &storage = store();
+    const QVector<int> ids = storage.complete(p, limit);
+    out.reserve(ids.size());
+    for (int id : ids) out.append(storage.word(id));
+    return out;
+}
+
+QStringList Function::suggestWords(const QString &word, int limit) const {
+    QStringList out;
+    const QString w = word.trimmed();
+    if (w.isEmpty()) return out;
+
+    // Two edits on a very short word matches almost anything.
+    const int maxDistance = w.size() <= 4 ? 1 : 2;
+
+    const WordStorage &storage = store();
+    const QVector<int> ids = storage.suggest(w, maxDistance, limit);
+    out.reserve(ids.size());
+    for (int id : ids) out.append(storage.word(id));
+    return out;
+}
+
+QVector<QPair<QString, QString>> Function::searchDefinitions(const QString &query, int limit) const {
+    QVector<QPair<QString, QString>> out;
+    if (query.trimmed().isEmpty() || limit <= 0) return out;
+
+    const WordStorage &storage = store();
+    const auto ranked = storage.rankText(query, limit);
+    out.reserve(ranked.size());
+    for (const auto &r : ranked) {
+        out.append(qMakePair(storage.word(r.first), storage.definition(r.first)));
+    }
+    return out;
+}
+
+QVector<QPair<QString, QString>> Function::searchTagalog(const QString &tagalog) const {
+    QVector<QPair<QString, QString>> out;
+    if (tagalog.trimmed().isEmpty()) return out;
+
+    const WordStorage &storage = store();
+    for (int id : storage.findTagalog(tagalog)) {
+        out.append(qMakePair(storage.word(id), storage.translation(id).title));
     }
     return out;
 }
 
 bool Function::addWordEntry(const WordEntry &entry)
 {
-    WordStorage::instance().addWord(entry);
+    if (!WordStorage::instance().addWord(entry)) return false; // duplicate
 
     QString currentUserName = UserStorage::instance().currentUser();
     if (!currentUserName.isEmpty()) {
@@ -80,7 +128,7 @@ bool Function::addWordEntry(const WordEntry &entry)
         }
     }
 
-    return WordStorage::instance().save();
+    return WordStorage::instance().appendToJournal(entry);
 }
 
 bool Function::addWordFromInputs(const QString &word,
@@ -2,23 +2,54 @@
 #define FUNCTION_H
 
 #include <QString>
+#include <QStringList>
 #include <QVector>
 #include <QPair>
 #include "Word_Files/Word_Storage.h"
+#include <memory>
 
 class Function {
 private:
     QChar normalizeKey(const QString &word) const;
+    // Store read by the lookup functions: the pinned version, if any, else
+    // the live WordStorage::instance().
+    const WordStorage &store() const { return m_storage ? *m_storage : WordStorage::instance(); }
+
+    int m_maxPerLetter = 0; // 0 = no limit
+    std::shared_ptr<const WordStorage> m_storage;
 
 public:
     Function() = default;
+    // Lookups read `storage` (e.g. WordStorage::published()), so they can
+    // run off the GUI thread. Adding words still goes to the live store.
+    explicit Function(std::shared_ptr<const WordStorage> storage) : m_storage(std::move(storage)) {}
+
+    // Optional cap on the words stored per initial letter, enforced by
+    // addWord(); 0 (the default) means no limit.
+    void setMaxWordsPerLetter(int max) { m_maxPerLetter = qMax(0, max); }
+    int maxWordsPerLetter() const { return m_maxPerLetter; }
 
-    // Updated signatures with translation support
+    // Returns 0 on success, 1 for invalid input, 2 if the letter is at the
+    // configured cap and 3 for a duplicate.
     int addWord(const QString &word, const QString &definition, const QString &translation = QString());
 
     QString searchWord(const QString &word, bool getTranslation = false) const;
     QVector<QPair<QString, QString>> getWordsByLetter(QChar letter, bool getTranslation = false) const;
 
+    // Up to `limit` stored words starting with `prefix`, for search-as-you-type.
+    QStringList completePrefix(const QString &prefix, int limit = 10) const;
+
+    // Up to `limit` stored words close to `word` (1-2 typos), closest first.
+    QStringList suggestWords(const QString &word, int limit = 5) const;
+
+    // Stored words whose definition, usage or background contain every term
+    // of `query`, with their definitions, most relevant first.
+    QVector<QPair<QString, QString>> searchDefinitions(const QString &query, int limit = 50) const;
+
+    // English words whose Tagalog translation matches `tagalog`, paired with
+    // that translation's Tagalog word.
+    QVector<QPair<QString, QString>> searchTagalog(const QString &tagalog) const;
+
     bool addWordEntry(const WordEntry &entry);
     bool addWordFromInputs(const QString &word,
                            const QString &definition,
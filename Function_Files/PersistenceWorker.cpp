@@ -0,0 +1,183 @@
+#include "Function_Files/PersistenceWorker.h"
+#include <QTimer>
+#include <QFile>
+#include <QSaveFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QMutexLocker>
+
+namespace {
+// How long edits are gathered before they are written.
+const int COALESCE_MS = 250;
+
+// Replaces `path` atomically so a crash mid-write never leaves a torn file.
+// Written in binary mode: snapshots are not text, and JSON reads fine either way.
+bool writeFile(const QString &path, const QByteArray &data)
+{
+    QDir().mkpath(QFileInfo(path).absolutePath());
+    QSaveFile f(path);
+    if (!f.open(QIODevice::WriteOnly)) return false;
+    if (f.write(data) != data.size()) {
+        f.cancelWriting();
+        return false;
+    }
+    return f.commit();
+}
+
+bool appendFile(const QString &path, const QByteArray &data)
+{
+    QDir().mkpath(QFileInfo(path).absolutePath());
+    QFile f(path);
+    if (!f.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text)) return false;
+    const bool ok = f.write(data) == data.size();
+    f.close();
+    return ok;
+}
+}
+
+PersistenceWorker &PersistenceWorker::instance()
+{
+    static PersistenceWorker s;
+    return s;
+}
+
+PersistenceWorker::PersistenceWorker()
+    : m_timer(new QTimer(this))
+{
+    m_timer->setSingleShot(true);
+    m_timer->setInterval(COALESCE_MS);
+    connect(m_timer, &QTimer::timeout, this, &PersistenceWorker::writePending);
+
+    m_thread.setObjectName("PersistenceWorker");
+    moveToThread(&m_thread);
+    m_thread.start();
+}
+
+PersistenceWorker::~PersistenceWorker()
+{
+    m_thread.quit();
+    m_thread.wait();
+}
+
+void PersistenceWorker::write(const QString &path, std::function<QByteArray()> serialize,
+                              const QString &obsoletes)
+{
+    Operation op;
+    op.kind = Operation::Write;
+    op.path = path;
+    op.serialize = std::move(serialize);
+    op.obsoletes = obsoletes;
+    enqueue(std::move(op));
+}
+
+void PersistenceWorker::append(const QString &path, const QByteArray &data)
+{
+    Operation op;
+    op.kind = Operation::Append;
+    op.path = path;
+    op.data = data;
+    enqueue(std::move(op));
+}
+
+void PersistenceWorker::remove(const QString &path)
+{
+    Operation op;
+    op.kind = Operation::Remove;
+    op.path = path;
+    enqueue(std::move(op));
+}
+
+void PersistenceWorker::enqueue(Operation op)
+{
+    {
+        QMutexLocker lock(&m_mutex);
+        bool merged = false;
+        if (op.kind == Operation::Write) {
+            // A newer snapshot supersedes a queued one. It takes the old
+            // one's place so it still runs before anything queued after it.
+            for (Operation &queued : m_pending) {
+                if (queued.kind == Operation::Write && queued.path == op.path) {
+                    queued.serialize = std::move(op.serialize);
+                    if (!op.obsoletes.isEmpty()) queued.obsoletes = op.obsoletes;
+                    merged = true;
+                    break;
+                }
+            }
+        } else if (op.kind == Operation::Append && !m_pending.isEmpty()) {
+            Operation &last = m_pending.last();
+            if (last.kind == Operation::Append && last.path == op.path) {
+                last.data += op.data;
+                merged = true;
+            }
+        }
+        if (!merged) m_pending.append(std::move(op));
+    }
+
+    if (m_thread.isRunning()) {
+        QMetaObject::invokeMethod(this, &PersistenceWorker::schedule, Qt::QueuedConnection);
+    }
+}
+
+// Runs on the worker thread: starts the coalescing window if it is not open yet.
+void PersistenceWorker::schedule()
+{
+    if (!m_timer->isActive()) m_timer->start();
+}
+
+void PersistenceWorker::writePending()
+{
+    QVector<Operation> ops;
+    {
+        QMutexLocker lock(&m_mutex);
+        ops.swap(m_pending);
+        for (const Operation &op : ops) m_inFlight.append(op.path);
+    }
+
+    for (const Operation &op : ops) {
+        bool ok = false;
+        switch (op.kind) {
+        case Operation::Write:
+            ok = writeFile(op.path, op.serialize());
+            // Only drop the superseded file once its replacement is on disk.
+            if (ok && !op.obsoletes.isEmpty()) QFile::remove(op.obsoletes);
+            break;
+        case Operation::Append:
+            ok = appendFile(op.path, op.data);
+            break;
+        case Operation::Remove:
+            ok = !QFile::exists(op.path) || QFile::remove(op.path);
+            break;
+        }
+        {
+            QMutexLocker lock(&m_mutex);
+            m_inFlight.removeOne(op.path);
+        }
+        emit written(op.path, ok);
+    }
+}
+
+bool PersistenceWorker::isPending(const QString &path) const
+{
+    QMutexLocker lock(&m_mutex);
+    if (m_inFlight.contains(path)) return true;
+    for (const Operation &op : m_pending) {
+        if (op.path == path) return true;
+    }
+    return false;
+}
+
+void PersistenceWorker::flush()
+{
+    if (!m_thread.isRunning() || QThread::currentThread() == &m_thread) {
+        writePending();
+        return;
+    }
+    QMetaObject::invokeMethod(this, &PersistenceWorker::writePending, Qt::BlockingQueuedConnection);
+}
+
+void PersistenceWorker::shutdown()
+{
+    flush();
+    m_thread.quit();
+    m_thread.wait();
+}
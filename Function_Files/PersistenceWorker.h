@@ -0,0 +1,73 @@
+#ifndef PERSISTENCEWORKER_H
+#define PERSISTENCEWORKER_H
+
+#include <QObject>
+#include <QThread>
+#include <QMutex>
+#include <QVector>
+#include <QString>
+#include <QStringList>
+#include <QByteArray>
+#include <functional>
+
+class QTimer;
+
+// Singleton that performs all file writes for WordStorage and UserStorage on
+// a background thread, so button handlers never block on disk.
+//
+// Operations are queued from the GUI thread and written after a short
+// coalescing window: a newer snapshot of a file replaces the pending one and
+// consecutive appends are merged, so a burst of edits produces a handful of
+// writes. Operations otherwise run in the order they were queued.
+class PersistenceWorker : public QObject {
+    Q_OBJECT
+public:
+    static PersistenceWorker &instance();
+
+    // Queues a full rewrite of `path`. `serialize` runs on the worker thread,
+    // so it must only use data it captured by value (an immutable snapshot).
+    // If given, `obsoletes` is removed once the new file has been written.
+    void write(const QString &path, std::function<QByteArray()> serialize,
+               const QString &obsoletes = QString());
+    void append(const QString &path, const QByteArray &data);
+    void remove(const QString &path);
+
+    // True while an operation on `path` is queued or being written, i.e.
+    // the file may not reflect the latest write() yet.
+    bool isPending(const QString &path) const;
+
+    // Blocks until every queued operation has been written.
+    void flush();
+    // Flushes and stops the worker thread; later operations run inline on flush().
+    void shutdown();
+
+signals:
+    // Emitted on the worker thread after each operation.
+    void written(const QString &path, bool ok);
+
+private slots:
+    void schedule();
+    void writePending();
+
+private:
+    PersistenceWorker();
+    ~PersistenceWorker() override;
+
+    struct Operation {
+        enum Kind { Write, Append, Remove } kind;
+        QString path;
+        std::function<QByteArray()> serialize; // Write
+        QString obsoletes;                     // Write
+        QByteArray data;                       // Append
+    };
+
+    void enqueue(Operation op);
+
+    QThread m_thread;
+    QTimer *m_timer;
+    mutable QMutex m_mutex;      // guards m_pending and m_inFlight
+    QVector<Operation> m_pending;
+    QStringList m_inFlight;      // paths taken by writePending() and not done yet
+};
+
+#endif // PERSISTENCEWORKER_H
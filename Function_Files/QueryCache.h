@@ -0,0 +1,94 @@
+#ifndef QUERYCACHE_H
+#define QUERYCACHE_H
+
+#include <QHash>
+#include <QString>
+#include <atomic>
+#include <list>
+
+// Least-recently-used cache of query results, keyed by (mode, normalized
+// query). The cache is stamped with the WordStorage::generation() its
+// results were computed from: a lookup against any other generation drops
+// every entry first, so results never outlive the dictionary they describe.
+//
+// lookup()/insert() belong to one thread; the hit and miss counters may be
+// read from any thread.
+template <typename Value>
+class QueryCache {
+public:
+    explicit QueryCache(int capacity = 256) : m_capacity(qMax(1, capacity)) {}
+
+    // Copies the cached result for (mode, query) into `value`. Returns false
+    // on a miss, or if `generation` is not the one the cache holds.
+    bool lookup(quint64 generation, int mode, const QString &query, Value &value)
+    {
+        stamp(generation);
+        const auto it = m_index.constFind(Key{ mode, query });
+        if (it == m_index.constEnd()) {
+            m_misses.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        m_items.splice(m_items.begin(), m_items, it.value()); // now most recent
+        value = it.value()->second;
+        m_hits.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Stores `value` as the result of (mode, query) at `generation`,
+    // evicting the least recently used result if the cache is full.
+    void insert(quint64 generation, int mode, const QString &query, const Value &value)
+    {
+        stamp(generation);
+        const Key key{ mode, query };
+        const auto it = m_index.constFind(key);
+        if (it != m_index.constEnd()) {
+            it.value()->second = value;
+            m_items.splice(m_items.begin(), m_items, it.value());
+            return;
+        }
+        if (m_index.size() >= m_capacity) {
+            m_index.remove(m_items.back().first);
+            m_items.pop_back();
+        }
+        m_items.emplace_front(key, value);
+        m_index.insert(key, m_items.begin());
+    }
+
+    void clear()
+    {
+        m_items.clear();
+        m_index.clear();
+    }
+
+    int size() const { return m_index.size(); }
+    int capacity() const { return m_capacity; }
+    quint64 hits() const { return m_hits.load(std::memory_order_relaxed); }
+    quint64 misses() const { return m_misses.load(std::memory_order_relaxed); }
+
+private:
+    struct Key {
+        int mode;
+        QString query;
+        bool operator==(const Key &other) const { return mode == other.mode && query == other.query; }
+    };
+    friend size_t qHash(const Key &key, size_t seed = 0) { return qHashMulti(seed, key.mode, key.query); }
+
+    using Items = std::list<std::pair<Key, Value>>; // most recently used first
+
+    // Drops every result computed from another generation.
+    void stamp(quint64 generation)
+    {
+        if (generation == m_generation) return;
+        clear();
+        m_generation = generation;
+    }
+
+    int m_capacity;
+    quint64 m_generation = 0;
+    Items m_items;
+    QHash<Key, typename Items::iterator> m_index;
+    std::atomic<quint64> m_hits{0};
+    std::atomic<quint64> m_misses{0};
+};
+
+#endif // QUERYCACHE_H
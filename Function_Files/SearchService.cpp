@@ -0,0 +1,141 @@
+#include "Function_Files/SearchService.h"
+#include "Function_Files/Function.h"
+#include <QTimer>
+
+SearchService::SearchService(QObject *parent)
+    : QObject(parent),
+      m_worker(new QObject)
+{
+    qRegisterMetaType<SearchService::Result>();
+    for (auto &latest : m_latest) latest.store(0, std::memory_order_relaxed);
+
+    m_thread.setObjectName("SearchService");
+    m_worker->moveToThread(&m_thread);
+    connect(&m_thread, &QThread::finished, m_worker, &QObject::deleteLater);
+    m_thread.start();
+}
+
+SearchService::~SearchService()
+{
+    // Cancel whatever is queued or running, then stop the thread.
+    for (auto &latest : m_latest) latest.store(~quint64(0), std::memory_order_release);
+    m_thread.quit();
+    m_thread.wait();
+}
+
+quint64 SearchService::submit(Kind kind, const QString &text, int limit)
+{
+    Request request;
+    request.serial = ++m_nextSerial;
+    request.kind = kind;
+    request.text = text;
+    request.limit = limit;
+
+    // Publishing the serial first cancels older queries on the channel. A
+    // pane search also closes the completion popup, so it cancels pending
+    // completions too.
+    m_latest[channelOf(kind)].store(request.serial, std::memory_order_release);
+    if (kind != Complete) m_latest[CompletionChannel].store(request.serial, std::memory_order_release);
+
+    if (!m_backlog.isEmpty() || !m_queue.push(request)) {
+        // The worker is far behind; keep the request and retry shortly.
+        m_backlog.append(request);
+        QTimer::singleShot(1, this, &SearchService::pushBacklog);
+        return request.serial;
+    }
+    QMetaObject::invokeMethod(m_worker, [this]() { drain(); }, Qt::QueuedConnection);
+    return request.serial;
+}
+
+bool SearchService::isCurrent(const Result &result) const
+{
+    return result.serial == m_latest[channelOf(result.kind)].load(std::memory_order_acquire);
+}
+
+// Moves waiting requests into the queue, dropping those already superseded.
+void SearchService::pushBacklog()
+{
+    while (!m_backlog.isEmpty()) {
+        if (isStale(m_backlog.first())) {
+            m_backlog.removeFirst();
+            continue;
+        }
+        if (!m_queue.push(m_backlog.first())) {
+            QTimer::singleShot(1, this, &SearchService::pushBacklog);
+            break;
+        }
+        m_backlog.removeFirst();
+    }
+    QMetaObject::invokeMethod(m_worker, [this]() { drain(); }, Qt::QueuedConnection);
+}
+
+// Worker thread: runs every queued request that is still current.
+void SearchService::drain()
+{
+    Request request;
+    while (m_queue.pop(request)) {
+        if (isStale(request)) continue;
+        Result result;
+        if (run(request, result)) emit finished(result);
+    }
+}
+
+bool SearchService::isStale(const Request &request) const
+{
+    return request.serial != m_latest[channelOf(request.kind)].load(std::memory_order_acquire);
+}
+
+// Runs one request against the latest published version, or answers it from
+// the cache. Returns false if it was superseded on the way; the checks sit
+// between the expensive steps.
+bool SearchService::run(const Request &request, Result &result)
+{
+    const auto storage = WordStorage::published();
+    if (!storage) return false;
+
+    // Every kind matches case-insensitively and ignores surrounding blanks.
+    // The limit changes the answer, so it is part of the mode.
+    const QString query = WordStorage::foldKey(request.text.trimmed());
+    const int mode = int(request.kind) | (request.limit << 8);
+    if (!m_cache.lookup(storage->generation(), mode, query, result)) {
+        compute(request, storage, result);
+        if (isStale(request)) return false; // possibly cut short; not cached
+        m_cache.insert(storage->generation(), mode, query, result);
+    }
+
+    result.serial = request.serial;
+    result.kind = request.kind;
+    result.query = request.text;
+    return !isStale(request);
+}
+
+// Computes the answer to `request` from `storage`. Stops early, leaving the
+// result incomplete, once the request is superseded.
+void SearchService::compute(const Request &request, const std::shared_ptr<const WordStorage> &storage,
+                            Result &result) const
+{
+    const Function search(storage);
+    switch (request.kind) {
+    case Complete:
+        result.words = search.completePrefix(request.text, request.limit);
+        break;
+    case Lookup: {
+        const int id = storage->find(request.text.trimmed());
+        result.found = id >= 0;
+        if (result.found) {
+            result.entry = storage->entry(id);
+        } else if (!isStale(request)) {
+            result.words = search.suggestWords(request.text, request.limit > 0 ? request.limit : 5);
+        }
+        break;
+    }
+    case Definitions:
+        result.matches = search.searchDefinitions(request.text, request.limit);
+        break;
+    case Tagalog:
+        result.matches = search.searchTagalog(request.text);
+        break;
+    case KindCount:
+        break;
+    }
+}
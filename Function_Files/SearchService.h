@@ -0,0 +1,99 @@
+#ifndef SEARCHSERVICE_H
+#define SEARCHSERVICE_H
+
+#include <QObject>
+#include <QThread>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QPair>
+#include <atomic>
+#include "Function_Files/SpscQueue.h"
+#include "Function_Files/QueryCache.h"
+#include "Word_Files/Word_Storage.h"
+
+// Runs searches on a background thread so typing never waits on them.
+// Repeated queries are answered from a QueryCache until the dictionary
+// changes.
+//
+// The GUI thread submits queries through a lock-free single-producer/
+// single-consumer queue. A query supersedes the earlier ones that would show
+// in the same place: a completion replaces earlier completions, and a
+// lookup, definition or Tagalog search (which share the result pane)
+// replaces earlier ones of all three, as well as any pending completion.
+// Superseded queries are skipped if still queued, and abandoned at the next
+// checkpoint if already running. Results come back through finished(),
+// which is delivered to GUI-thread receivers as a queued signal. Every query
+// reads one published WordStorage version from start to end.
+class SearchService : public QObject {
+    Q_OBJECT
+public:
+    enum Kind {
+        Complete,    // headwords starting with the text
+        Lookup,      // exact word, with "did you mean" suggestions on a miss
+        Definitions, // ranked full-text search of definitions
+        Tagalog,     // English words for a Tagalog word
+        KindCount
+    };
+
+    struct Result {
+        quint64 serial = 0;
+        Kind kind = Complete;
+        QString query;
+        QStringList words;                         // Complete; Lookup suggestions
+        QVector<QPair<QString, QString>> matches;  // Definitions, Tagalog
+        WordEntry entry;                           // Lookup
+        bool found = false;                        // Lookup
+    };
+
+    explicit SearchService(QObject *parent = nullptr);
+    ~SearchService();
+
+    // Queues a query and returns its serial. `limit` caps the number of
+    // results for kinds that have one. Must be called from the owning thread.
+    quint64 submit(Kind kind, const QString &text, int limit = 0);
+
+    // True if `result` answers the latest query for where it is shown.
+    bool isCurrent(const Result &result) const;
+
+    // Result cache statistics, for sizing CACHE_SIZE. Safe from any thread.
+    quint64 cacheHits() const { return m_cache.hits(); }
+    quint64 cacheMisses() const { return m_cache.misses(); }
+
+signals:
+    void finished(const SearchService::Result &result);
+
+private:
+    struct Request {
+        quint64 serial = 0;
+        Kind kind = Complete;
+        QString text;
+        int limit = 0;
+    };
+
+    void pushBacklog();
+    void drain();
+    // Where results are shown; queries on one channel supersede each other.
+    enum Channel { CompletionChannel, PaneChannel, ChannelCount };
+    static Channel channelOf(Kind kind) { return kind == Complete ? CompletionChannel : PaneChannel; }
+
+    bool isStale(const Request &request) const;
+    bool run(const Request &request, Result &result);
+    void compute(const Request &request, const std::shared_ptr<const WordStorage> &storage,
+                 Result &result) const;
+
+    static const std::size_t QUEUE_SIZE = 64;
+    static const int CACHE_SIZE = 256;
+
+    QThread m_thread;
+    QObject *m_worker; // lives on m_thread; queued calls to it run there
+    SpscQueue<Request, QUEUE_SIZE> m_queue;
+    std::atomic<quint64> m_latest[ChannelCount]; // newest serial per channel
+    quint64 m_nextSerial = 0;                 // producer side only
+    QVector<Request> m_backlog;               // requests that found the queue full
+    QueryCache<Result> m_cache{CACHE_SIZE};   // worker thread only
+};
+
+Q_DECLARE_METATYPE(SearchService::Result)
+
+#endif // SEARCHSERVICE_H
@@ -0,0 +1,46 @@
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+// Bounded lock-free queue for exactly one producer thread and one consumer
+// thread. Each side only writes its own index, so push() and pop() never
+// wait on each other; a full queue makes push() fail instead of blocking.
+template <typename T, std::size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity >= 2, "SpscQueue needs room for at least one element");
+
+public:
+    // Producer side.
+    bool push(T value)
+    {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        const std::size_t next = (tail + 1) % Capacity;
+        if (next == m_head.load(std::memory_order_acquire)) return false; // full
+        m_slots[tail] = std::move(value);
+        m_tail.store(next, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side.
+    bool pop(T &value)
+    {
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail.load(std::memory_order_acquire)) return false; // empty
+        value = std::move(m_slots[head]);
+        m_slots[head] = T(); // release what the slot held
+        m_head.store((head + 1) % Capacity, std::memory_order_release);
+        return true;
+    }
+
+private:
+    std::array<T, Capacity> m_slots;
+    // Kept on separate cache lines so the two threads do not contend.
+    alignas(64) std::atomic<std::size_t> m_head{0}; // next slot to pop
+    alignas(64) std::atomic<std::size_t> m_tail{0}; // next slot to push
+};
+
+#endif // SPSCQUEUE_H
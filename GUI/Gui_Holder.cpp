@@ -7,7 +7,9 @@
 #include "User_Files/UserStorage.h" 
 #include "Word_Files/Word_Storage.h" 
 #include "User_Files/User.h" 
-#include <QListWidget>
+#include "Function_Files/PersistenceWorker.h"
+#include "GUI/WordListModel.h"
+#include <QListView>
 
 
 // Helper function to extract initials from a full name.
@@ -90,8 +92,13 @@ Gui_Holder::Gui_Holder(QWidget *parent)
 
     setupUI();
 
-    // Ensure words are loaded from storage.
-    WordStorage::instance().load();
+    // Saves run on the persistence thread; report any that fail.
+    connect(&PersistenceWorker::instance(), &PersistenceWorker::written, this,
+            [](const QString &path, bool ok) {
+                if (!ok) qWarning("Gui_Holder: failed to write '%s'.", qPrintable(path));
+            });
+
+    // Words are already loaded by DataLoader before the window is created.
 
     // Update the profile button's appearance.
     updateProfileView();
@@ -239,7 +246,22 @@ void Gui_Holder::setupUI()
     sLay->setContentsMargins(15, 15, 15, 15); 
     sLay->addWidget(new QLabel(tr("Search Word:"), searchTab));
     wordInputSearch = new QLineEdit(searchTab);
+    // Suggestions come pre-filtered from the prefix index, so the completer
+    // shows the model as-is instead of filtering it again.
+    m_suggestionModel = new QStringListModel(this);
+    m_searchCompleter = new QCompleter(m_suggestionModel, this);
+    m_searchCompleter->setCompletionMode(QCompleter::UnfilteredPopupCompletion);
+    m_searchCompleter->setCaseSensitivity(Qt::CaseInsensitive);
+    wordInputSearch->setCompleter(m_searchCompleter);
+    connect(wordInputSearch, &QLineEdit::textEdited, this, &Gui_Holder::on_wordInputSearch_textEdited);
+    connect(m_searchCompleter, QOverload<const QString &>::of(&QCompleter::activated),
+            this, &Gui_Holder::on_searchWordButton_clicked);
     sLay->addWidget(wordInputSearch);
+    searchModeCombo = new QComboBox(searchTab);
+    searchModeCombo->addItem(tr("Search words"));                // WordSearch
+    searchModeCombo->addItem(tr("Search inside definitions"));   // DefinitionSearch
+    searchModeCombo->addItem(tr("Tagalog to English"));          // TagalogSearch
+    sLay->addWidget(searchModeCombo);
     searchWordButton = new QPushButton(tr("Search"), searchTab);
     sLay->addWidget(searchWordButton);
     resultOutputSearch = new QTextEdit(searchTab);
@@ -249,6 +271,9 @@ void Gui_Holder::setupUI()
     sLay->addWidget(resultOutputSearch);
     sLay->addStretch();
     connect(searchWordButton, &QPushButton::clicked, this, &Gui_Holder::on_searchWordButton_clicked);
+    // Searches run on the search thread; results are delivered back here.
+    m_search = new SearchService(this);
+    connect(m_search, &SearchService::finished, this, &Gui_Holder::on_searchFinished);
     tabs->addTab(searchTab, tr("Search"));
 
     // Setup the "Browse" tab.
@@ -260,7 +285,10 @@ void Gui_Holder::setupUI()
     // Populate combo box with letters A-Z.
     for (char c='A'; c<='Z'; ++c) letterComboBox->addItem(QString(c));
     bLay->addWidget(letterComboBox);
-    browseOutput = new QListWidget(browseTab);
+    m_browseModel = new WordListModel(this);
+    browseOutput = new QListView(browseTab);
+    browseOutput->setModel(m_browseModel);
+    browseOutput->setUniformItemSizes(true); // rows are laid out without measuring each one
     browseOutput->setStyleSheet("background-color: #f8f8f8;"); 
     browseOutput->setMinimumHeight(300);
     browseOutput->setSelectionMode(QAbstractItemView::SingleSelection);
@@ -271,7 +299,7 @@ void Gui_Holder::setupUI()
             this, &Gui_Holder::on_letterComboBox_currentIndexChanged);
     
     // Connect list item click to open detail window
-    connect(browseOutput, &QListWidget::itemClicked, this, &Gui_Holder::on_browseItem_clicked);
+    connect(browseOutput, &QListView::clicked, this, &Gui_Holder::on_browseItem_clicked);
 
     // Trigger the initial display of words starting with 'A'
     on_letterComboBox_currentIndexChanged(0);
@@ -347,28 +375,114 @@ void Gui_Holder::on_addWordButton_clicked()
     }
 }
 
-// Handles the Search Definition button click event: retrieves and displays word details.
+// Handles the Search Definition button click event: queues the lookup for the
+// selected mode. The answer arrives in on_searchFinished().
 void Gui_Holder::on_searchWordButton_clicked()
 {
     QString key = wordInputSearch->text().trimmed();
     if (key.isEmpty()) return;
-    
-    // Search for the word in storage.
-    auto words = WordStorage::instance().allWords();
-    for (const auto &e : words) {
-        if (e.word.compare(key, Qt::CaseInsensitive) == 0) {
-            QString out;
-            out += "Word: " + e.word + "\n\n";
-            out += "Definition: " + e.definition + "\n\n";
-            out += "Synonyms: " + e.synonyms.join(", ") + "\n";
-            out += "Antonyms: " + e.antonyms.join(", ") + "\n\n";
-            out += "Background: " + e.background + "\n\n";
-            out += "Usage: " + e.usage + "\n";
-            resultOutputSearch->setPlainText(out);
-            return;
+
+    const int MAX_RESULTS = 50;
+    switch (searchModeCombo->currentIndex()) {
+    case DefinitionSearch:
+        m_search->submit(SearchService::Definitions, key, MAX_RESULTS);
+        break;
+    case TagalogSearch:
+        m_search->submit(SearchService::Tagalog, key);
+        break;
+    default:
+        m_search->submit(SearchService::Lookup, key);
+        break;
+    }
+}
+
+// Shows a finished search, unless a newer one for the same place was queued.
+void Gui_Holder::on_searchFinished(const SearchService::Result &result)
+{
+    if (!m_search->isCurrent(result)) return;
+
+    switch (result.kind) {
+    case SearchService::Complete:
+        // The mode may have changed while the suggestions were computed.
+        if (searchModeCombo->currentIndex() != WordSearch) return;
+        m_suggestionModel->setStringList(result.words);
+        if (m_suggestionModel->rowCount() > 0) m_searchCompleter->complete();
+        break;
+    case SearchService::Lookup:
+        showWordResult(result);
+        break;
+    case SearchService::Definitions:
+        showDefinitionMatches(result.query, result.matches);
+        break;
+    case SearchService::Tagalog:
+        showTagalogMatches(result.query, result.matches);
+        break;
+    default:
+        break;
+    }
+}
+
+// Displays a looked-up word, or "did you mean" suggestions if it is missing.
+void Gui_Holder::showWordResult(const SearchService::Result &result)
+{
+    if (!result.found) {
+        QString out = tr("Not found");
+        if (!result.words.isEmpty()) {
+            out += "\n\n" + tr("Did you mean: %1?").arg(result.words.join(", "));
         }
+        resultOutputSearch->setPlainText(out);
+        return;
     }
-    resultOutputSearch->setPlainText(tr("Not found"));
+
+    const WordEntry &e = result.entry;
+    QString out;
+    out += "Word: " + e.word + "\n\n";
+    out += "Definition: " + e.definition + "\n\n";
+    out += "Synonyms: " + e.synonyms.join(", ") + "\n";
+    out += "Antonyms: " + e.antonyms.join(", ") + "\n\n";
+    out += "Background: " + e.background + "\n\n";
+    out += "Usage: " + e.usage + "\n";
+    resultOutputSearch->setPlainText(out);
+}
+
+// Lists the words whose definition, usage or background contain every term of the query.
+void Gui_Holder::showDefinitionMatches(const QString &query, const QVector<QPair<QString, QString>> &matches)
+{
+    if (matches.isEmpty()) {
+        resultOutputSearch->setPlainText(tr("No definitions contain \"%1\".").arg(query));
+        return;
+    }
+
+    QString out;
+    for (const auto &m : matches) out += m.first + " - " + m.second + "\n\n";
+    resultOutputSearch->setPlainText(out.trimmed());
+}
+
+// Lists the English words whose Tagalog translation matches the query.
+void Gui_Holder::showTagalogMatches(const QString &query, const QVector<QPair<QString, QString>> &matches)
+{
+    if (matches.isEmpty()) {
+        resultOutputSearch->setPlainText(tr("No English word found for \"%1\".").arg(query));
+        return;
+    }
+
+    QString out;
+    for (const auto &m : matches) out += m.first + " (" + m.second + ")\n";
+    resultOutputSearch->setPlainText(out.trimmed());
+}
+
+// Refreshes the search suggestions as the user types.
+void Gui_Holder::on_wordInputSearch_textEdited(const QString &text)
+{
+    // Headword suggestions only apply to English word searches.
+    if (searchModeCombo->currentIndex() != WordSearch) {
+        m_suggestionModel->setStringList(QStringList());
+        return;
+    }
+
+    // Each keystroke supersedes the previous one's pending completion.
+    const int MAX_SUGGESTIONS = 10;
+    m_search->submit(SearchService::Complete, text, MAX_SUGGESTIONS);
 }
 
 // Updates the browse list when a new letter is selected in the combo box.
@@ -376,32 +490,18 @@ void Gui_Holder::on_letterComboBox_currentIndexChanged(int index)
 {
     if (index < 0) return;
     QChar letter = letterComboBox->itemText(index).at(0);
-    // Get all words starting with that letter.
-    auto list = WordStorage::instance().wordsForLetter(letter);
-    browseOutput->clear();
-    for (const auto &e : list) {
-        QListWidgetItem *it = new QListWidgetItem(e.word + " - " + e.definition, browseOutput);
-        it->setData(Qt::UserRole, e.word);
-        browseOutput->addItem(it);
-    }
+    // The model shares the letter's id list and builds row text on demand.
+    m_browseModel->setLetter(letter);
+    browseOutput->scrollToTop();
 }
 
 // Slot: open WordDetailWindow when a browse item is clicked
-void Gui_Holder::on_browseItem_clicked(QListWidgetItem *item)
+void Gui_Holder::on_browseItem_clicked(const QModelIndex &index)
 {
-    if (!item) return;
-    QString key = item->data(Qt::UserRole).toString();
-    if (key.isEmpty()) return;
-
-    // Find the full WordEntry for the selected word
-    auto all = WordStorage::instance().allWords();
-    for (const auto &e : all) {
-        if (e.word.compare(key, Qt::CaseInsensitive) == 0) {
-            WordDetailWindow dlg(e, this);
-            dlg.exec();
-            return;
-        }
-    }
+    const int id = m_browseModel->idAt(index.row());
+    if (id < 0) return;
+    WordDetailWindow dlg(WordStorage::instance().entry(id), this);
+    dlg.exec();
 }
 
 // Displays the current user's profile details in a new modal window.
@@ -434,8 +534,10 @@ void Gui_Holder::closeEvent(QCloseEvent *event)
                                       QMessageBox::Yes | QMessageBox::No,
                                       QMessageBox::No);
     if (res == QMessageBox::Yes) {
-        // Ensure words are persisted to file storage.
-        WordStorage::instance().save();
+        // Fold journaled words into the dictionary file; with nothing added
+        // since the last save, words.json and its snapshot are current.
+        WordStorage &storage = WordStorage::instance();
+        if (storage.unsavedChanges() > 0) storage.save();
         event->accept();
     } else {
         event->ignore();
@@ -8,13 +8,17 @@
 #include <QLineEdit>
 #include <QTextEdit>
 #include <QComboBox>
-#include <QListWidget>
+#include <QListView>
 #include <QPushButton>
 #include <QCloseEvent>
+#include "Function_Files/SearchService.h"
 
 // Forward Declarations
 class Function; 
 class AboutWindow;
+class QCompleter;
+class QStringListModel;
+class WordListModel;
 
 //The main window class for the DeepLingo application.
 //Manages the layout, main tabs, and top-bar actions (Profile and Settings).
@@ -32,12 +36,20 @@ private slots:
     void on_settingsButton_clicked(); 
     void on_addWordButton_clicked();
     void on_searchWordButton_clicked();
+    void on_wordInputSearch_textEdited(const QString &text);
     void on_letterComboBox_currentIndexChanged(int index);
-    void on_browseItem_clicked(QListWidgetItem *item);
+    void on_browseItem_clicked(const QModelIndex &index);
+    void on_searchFinished(const SearchService::Result &result);
 
 private:
     // UI Setup & Maintenance
     void setupUI();
+    void showWordResult(const SearchService::Result &result);
+    void showDefinitionMatches(const QString &query, const QVector<QPair<QString, QString>> &matches);
+    void showTagalogMatches(const QString &query, const QVector<QPair<QString, QString>> &matches);
+
+    // Entries of searchModeCombo.
+    enum SearchMode { WordSearch, DefinitionSearch, TagalogSearch };
     void updateProfileView();
     void updateProfileAvatar();
     void closeEvent(QCloseEvent *event) override;
@@ -60,11 +72,16 @@ private:
     // Search Tab Widgets
     QLineEdit *wordInputSearch;
     QPushButton *searchWordButton;
+    QComboBox *searchModeCombo;
     QTextEdit *resultOutputSearch;
+    QCompleter *m_searchCompleter;
+    QStringListModel *m_suggestionModel;
+    SearchService *m_search;
 
     // Browse Tab Widgets
     QComboBox *letterComboBox;
-    QListWidget *browseOutput;
+    QListView *browseOutput;
+    WordListModel *m_browseModel;
 
     // Application Functionality Holder
     Function *m_appFunction; 
@@ -3,9 +3,7 @@
 
 LoadingScreen::LoadingScreen(QWidget *parent) :
     QDialog(parent, Qt::SplashScreen | Qt::FramelessWindowHint), // Frameless and Splash Screen
-    m_timer(new QTimer(this)),
-    m_duration(0),
-    m_elapsed(0)
+    m_progress(0)
 {
     // Load the splash image
     if (m_splashImage.load("deeplingo_logo_loading.png")) {
@@ -33,9 +31,6 @@ LoadingScreen::LoadingScreen(QWidget *parent) :
     setAttribute(Qt::WA_TranslucentBackground);
     setWindowFlags(Qt::SplashScreen | Qt::FramelessWindowHint | Qt::WindowStaysOnTopHint | Qt::NoDropShadowWindowHint);
 
-    // Connect timer for progress updates
-    connect(m_timer, &QTimer::timeout, this, &LoadingScreen::updateProgress);
-
     // Center the splash screen
     const QScreen *screen = QGuiApplication::primaryScreen();
     if (screen) {
@@ -43,13 +38,24 @@ LoadingScreen::LoadingScreen(QWidget *parent) :
     }
 }
 
-void LoadingScreen::start(int durationMs) {
-    m_duration = durationMs;
-    m_elapsed = 0;
+void LoadingScreen::start() {
+    m_progress = 0;
     show();
-    m_timer->start(20); // Update progress every 20ms
 } 
 
+void LoadingScreen::setProgress(int percent) {
+    percent = qBound(0, percent, 100);
+    if (percent == m_progress) return;
+    m_progress = percent;
+    update(); // Request a repaint to update the progress bar
+}
+
+void LoadingScreen::finish() {
+    setProgress(100);
+    emit finished();
+    close();
+}
+
 void LoadingScreen::paintEvent(QPaintEvent *event) {
     Q_UNUSED(event);
     QPainter painter(this);
@@ -64,8 +70,8 @@ void LoadingScreen::paintEvent(QPaintEvent *event) {
     }
 
     // Draw the custom progress bar
-    if (m_duration > 0 && !m_splashImage.isNull()) {
-        double progress = static_cast<double>(m_elapsed) / m_duration;
+    if (!m_splashImage.isNull()) {
+        double progress = m_progress / 100.0;
         int barWidth = static_cast<int>(m_progressBarRect.width() * progress);
 
         // 1. Draw the background/outline of the progress bar (the empty square)
@@ -84,13 +90,3 @@ void LoadingScreen::paintEvent(QPaintEvent *event) {
         painter.drawRect(fillRect);
     }
 }
-
-void LoadingScreen::updateProgress() {
-    m_elapsed += m_timer->interval();
-    if (m_elapsed >= m_duration) {
-        m_timer->stop();
-        emit finished();
-        close();
-    }
-    update(); // Request a repaint to update the progress bar
-}
\ No newline at end of file
@@ -2,7 +2,6 @@
 #define LOADINGSCREEN_H
 
 #include <QDialog>
-#include <QTimer>
 #include <QPixmap> 
 #include <QRect> 
 
@@ -10,21 +9,20 @@ class LoadingScreen : public QDialog {
     Q_OBJECT
 public:
     explicit LoadingScreen(QWidget *parent = nullptr);
-    void start(int durationMs);
+    void start();
+
+public slots:
+    void setProgress(int percent); // 0-100, driven by the startup loader
+    void finish(); // Closes the screen and emits finished()
 
 signals:
-    void finished(); // Emitted when the loading duration is over
+    void finished(); // Emitted once loading is done
 
 protected:
     void paintEvent(QPaintEvent *event) override; // To draw the background image and progress bar
 
-private slots:
-    void updateProgress();
-
 private:
-    QTimer *m_timer;
-    int m_duration; // Total duration of the loading screen
-    int m_elapsed;  // Elapsed time
+    int m_progress; // Current progress in percent
     QPixmap m_splashImage; // The image for the splash screen
     
     // Position and size for the progress bar rectangle
@@ -237,14 +237,13 @@ void UserProfileWindow::on_addedWordClicked(QListWidgetItem *item) {
     if (wordKey == tr("None recorded.")) return; 
 
     // Look up the word details in WordStorage.
-    auto words = WordStorage::instance().allWords();
-    for (const auto &e : words) {
-        if (e.word.compare(wordKey, Qt::CaseInsensitive) == 0) {
-            // Found the word, open the detail window using the WordEntry struct.
-            WordDetailWindow detailDlg(e, this); 
-            detailDlg.exec();
-            return;
-        }
+    int id = WordStorage::instance().find(wordKey);
+    if (id < 0) {
+        QMessageBox::warning(this, tr("Error"), tr("Word details not found in storage."));
+        return;
     }
-    QMessageBox::warning(this, tr("Error"), tr("Word details not found in storage."));
+
+    // Found the word, open the detail window using the WordEntry struct.
+    WordDetailWindow detailDlg(WordStorage::instance().entry(id), this);
+    detailDlg.exec();
 }
\ No newline at end of file
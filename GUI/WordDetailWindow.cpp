@@ -12,9 +12,36 @@ WordDetailWindow::WordDetailWindow(const WordEntry &wordData, QWidget *parent)
     setupUI(wordData);
 }
 
+// Renders a word as a link to its entry when it is stored, or as plain text.
+static QString wordLink(const QString &text, int id)
+{
+    if (id < 0) return text.toHtmlEscaped();
+    return QString("<a href=\"%1\" style=\"color:#4CAF50;\">%2</a>").arg(id).arg(text.toHtmlEscaped());
+}
+
 // Sets up the UI elements based on the provided word data.
 void WordDetailWindow::setupUI(const WordEntry &wordData)
 {
+    // Resolve synonym, antonym and related-word links once, up front.
+    const WordStorage &storage = WordStorage::instance();
+    const int wordId = storage.find(wordData.word);
+    QStringList synLinks;
+    QStringList antLinks;
+    QStringList relatedLinks;
+    if (wordId >= 0) {
+        for (const auto &link : storage.links(wordId)) {
+            QStringList &target = link.kind == RelationIndex::Synonym ? synLinks : antLinks;
+            target.append(wordLink(link.text, link.target));
+        }
+        const int MAX_RELATED = 12;
+        for (int id : storage.related(wordId, 2).mid(0, MAX_RELATED)) {
+            relatedLinks.append(wordLink(storage.word(id), id));
+        }
+    } else {
+        for (const QString &w : wordData.synonyms) synLinks.append(w.toHtmlEscaped());
+        for (const QString &w : wordData.antonyms) antLinks.append(w.toHtmlEscaped());
+    }
+
     QVBoxLayout *mainLayout = new QVBoxLayout(this);
 
     QScrollArea *scrollArea = new QScrollArea(this);
@@ -73,18 +100,31 @@ void WordDetailWindow::setupUI(const WordEntry &wordData)
 
     // Synonyms
     QLabel *synLabel = new QLabel(tr("<b>Synonyms:</b>"));
-    synText = new QLabel(wordData.synonyms.join(", "));
+    synText = new QLabel(synLinks.join(", "));
+    synText->setTextFormat(Qt::RichText);
     synText->setWordWrap(true);
+    connect(synText, &QLabel::linkActivated, this, &WordDetailWindow::openLinkedWord);
     contentLayout->addWidget(synLabel);
     contentLayout->addWidget(synText);
 
     // Antonyms
     QLabel *antLabel = new QLabel(tr("<b>Antonyms:</b>"));
-    antText = new QLabel(wordData.antonyms.join(", "));
+    antText = new QLabel(antLinks.join(", "));
+    antText->setTextFormat(Qt::RichText);
     antText->setWordWrap(true);
+    connect(antText, &QLabel::linkActivated, this, &WordDetailWindow::openLinkedWord);
     contentLayout->addWidget(antLabel);
     contentLayout->addWidget(antText);
 
+    // Related words (within two synonym hops, in either direction)
+    QLabel *relatedLabel = new QLabel(tr("<b>Related Words:</b>"));
+    relatedText = new QLabel(relatedLinks.isEmpty() ? tr("None found.") : relatedLinks.join(", "));
+    relatedText->setTextFormat(Qt::RichText);
+    relatedText->setWordWrap(true);
+    connect(relatedText, &QLabel::linkActivated, this, &WordDetailWindow::openLinkedWord);
+    contentLayout->addWidget(relatedLabel);
+    contentLayout->addWidget(relatedText);
+
     // Background / Etymology
     QLabel *bgLabel = new QLabel(tr("<b>Background / Etymology:</b>"));
     bgText = new QTextEdit();
@@ -112,55 +152,21 @@ void WordDetailWindow::setupUI(const WordEntry &wordData)
     // Connect toggle button signal to switch between English and Tagalog
     // Prepare English originals so we can restore them when toggling back.
     m_engDef = wordData.definition;
-    m_engSyn = wordData.synonyms.join(", ");
-    m_engAnt = wordData.antonyms.join(", ");
+    m_engSyn = synLinks.join(", ");
+    m_engAnt = antLinks.join(", ");
     m_engBg = wordData.background;
     m_engUsage = wordData.usage;
     m_engWord = wordData.word;
 
-    // Parse labeled Tagalog sections from the single `translation` field when possible.
-    // Expected markers (in Tagalog data): "Kasingkahulugan:", "Kasalungat:", "Halimbawa:".
-    auto parseTranslation = [](const QString &t) {
-        QString defOut;
-        QString synOut;
-        QString antOut;
-        QString bgOut;
-        QString usageOut;
-
-        if (t.isEmpty()) return std::tuple<QString,QString,QString,QString,QString>(defOut,synOut,antOut,bgOut,usageOut);
-
-        // Split lines and look for markers
-        QStringList lines = t.split('\n', Qt::SkipEmptyParts);
-        QStringList pending;
-        for (const QString &ln : lines) {
-            QString L = ln.trimmed();
-            if (L.startsWith("Kasingkahulugan", Qt::CaseInsensitive)) {
-                // remove marker and collect
-                QString v = L.section(':', 1).trimmed();
-                synOut = v;
-            } else if (L.startsWith("Kasalungat", Qt::CaseInsensitive)) {
-                QString v = L.section(':', 1).trimmed();
-                antOut = v;
-            } else if (L.startsWith("Halimbawa", Qt::CaseInsensitive)) {
-                QString v = L.section(':', 1).trimmed();
-                usageOut = v;
-            } else {
-                pending.append(L);
-            }
-        }
-
-        // If pending lines exist, treat the first as the Tagalog definition
-        if (!pending.isEmpty()) {
-            defOut = pending.takeFirst();
-            // any remaining pending lines append to background if background empty
-            if (!pending.isEmpty()) bgOut = pending.join("\n");
-        }
-
-        return std::tuple<QString,QString,QString,QString,QString>(defOut,synOut,antOut,bgOut,usageOut);
-    };
-
-    const QString tagall = wordData.translation;
-    std::tie(m_tagDef, m_tagSyn, m_tagAnt, m_tagBg, m_tagUsage) = parseTranslation(tagall);
+    // Tagalog sections are parsed once when the dictionary is indexed;
+    // fall back to parsing here for an entry that is not in storage.
+    const Translation tag = wordId >= 0 ? storage.translation(wordId)
+                                        : Translation::parse(wordData.translation);
+    m_tagDef = tag.title;
+    m_tagSyn = tag.synonyms.join(", ");
+    m_tagAnt = tag.antonyms.join(", ");
+    m_tagBg = tag.notes;
+    m_tagUsage = tag.example;
     // tagDef is typically the first pending line; use it as Tagalog title when present
     m_tagTitle = m_tagDef;
 
@@ -209,3 +215,14 @@ void WordDetailWindow::setupUI(const WordEntry &wordData)
         showingTagalog = !showingTagalog;
     });
 }
+
+// Slot: link targets are entry ids resolved when the window was built.
+void WordDetailWindow::openLinkedWord(const QString &link)
+{
+    bool ok = false;
+    const int id = link.toInt(&ok);
+    if (!ok || id < 0 || id >= WordStorage::instance().size()) return;
+
+    WordDetailWindow dlg(WordStorage::instance().entry(id), this);
+    dlg.exec();
+}
@@ -17,6 +17,10 @@ public:
     // Constructor: Takes a constant reference to a WordEntry struct.
     explicit WordDetailWindow(const WordEntry &wordData, QWidget *parent = nullptr);
 
+private slots:
+    // Opens the detail window of a synonym, antonym or related word link.
+    void openLinkedWord(const QString &link);
+
 private:
     // Sets up the UI elements based on the provided WordEntry data.
     void setupUI(const WordEntry &wordData);
@@ -27,6 +31,7 @@ private:
     QTextEdit *defText;
     QLabel *synText;
     QLabel *antText;
+    QLabel *relatedText;
     QTextEdit *bgText;
     QTextEdit *usageText;
     QPushButton *toggleLangBtn;
@@ -0,0 +1,88 @@
+#include "GUI/WordListModel.h"
+#include "Word_Files/Word_Storage.h"
+
+WordListModel::WordListModel(QObject *parent)
+    : QAbstractListModel(parent)
+{
+    const WordChangeFeed &feed = WordStorage::changes();
+    connect(&feed, &WordChangeFeed::inserted, this, &WordListModel::onWordsInserted);
+    connect(&feed, &WordChangeFeed::reset, this, &WordListModel::onStorageReset);
+}
+
+void WordListModel::setLetter(QChar letter)
+{
+    beginResetModel();
+    m_letter = letter;
+    m_ids = WordStorage::instance().idsForLetter(letter);
+    m_loaded = qMin(PAGE_SIZE, int(m_ids.size()));
+    endResetModel();
+}
+
+int WordListModel::idAt(int row) const
+{
+    return row >= 0 && row < m_loaded ? m_ids.at(row) : -1;
+}
+
+int WordListModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_loaded;
+}
+
+QVariant WordListModel::data(const QModelIndex &index, int role) const
+{
+    const int id = idAt(index.row());
+    if (!index.isValid() || id < 0) return QVariant();
+
+    const WordStorage &storage = WordStorage::instance();
+    switch (role) {
+    case Qt::DisplayRole:
+        return storage.word(id) + " - " + storage.definition(id);
+    case Qt::ToolTipRole:
+        return storage.definition(id);
+    case IdRole:
+        return id;
+    default:
+        return QVariant();
+    }
+}
+
+bool WordListModel::canFetchMore(const QModelIndex &parent) const
+{
+    return !parent.isValid() && m_loaded < m_ids.size();
+}
+
+void WordListModel::fetchMore(const QModelIndex &parent)
+{
+    if (parent.isValid()) return;
+    const int more = qMin(PAGE_SIZE, int(m_ids.size()) - m_loaded);
+    if (more <= 0) return;
+    beginInsertRows(QModelIndex(), m_loaded, m_loaded + more - 1);
+    m_loaded += more;
+    endInsertRows();
+}
+
+// New ids are larger than every existing one, so added words of this letter
+// only ever extend the end of the bucket.
+void WordListModel::onWordsInserted(int first, int)
+{
+    if (m_letter.isNull()) return;
+
+    const QVector<int> &ids = WordStorage::instance().idsForLetter(m_letter);
+    if (ids.isEmpty() || ids.last() < first) return; // none start with this letter
+    const int added = int(ids.size() - m_ids.size());
+    if (added <= 0) return;
+
+    // Rows still paged out stay behind fetchMore(); if everything was shown,
+    // show the new rows too.
+    const bool showAll = m_loaded == m_ids.size();
+    m_ids = ids;
+    if (!showAll) return;
+    beginInsertRows(QModelIndex(), m_loaded, m_loaded + added - 1);
+    m_loaded += added;
+    endInsertRows();
+}
+
+void WordListModel::onStorageReset()
+{
+    if (!m_letter.isNull()) setLetter(m_letter);
+}
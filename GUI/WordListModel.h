@@ -0,0 +1,43 @@
+#ifndef WORDLISTMODEL_H
+#define WORDLISTMODEL_H
+
+#include <QAbstractListModel>
+#include <QVector>
+#include <QChar>
+
+// List model over the ids of one letter bucket in WordStorage.
+// Switching letters only copies the (implicitly shared) id list; rows are
+// exposed a page at a time through canFetchMore()/fetchMore(), and the
+// "word - definition" text is built in data() only for rows being shown.
+// Words added to the letter are appended as they are published.
+class WordListModel : public QAbstractListModel {
+    Q_OBJECT
+public:
+    // Role holding the entry id of a row.
+    enum Roles { IdRole = Qt::UserRole + 1 };
+
+    explicit WordListModel(QObject *parent = nullptr);
+
+    // Shows the words starting with `letter`, in insertion order.
+    void setLetter(QChar letter);
+    QChar letter() const { return m_letter; }
+    int idAt(int row) const;
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    bool canFetchMore(const QModelIndex &parent) const override;
+    void fetchMore(const QModelIndex &parent) override;
+
+private slots:
+    void onWordsInserted(int first, int last);
+    void onStorageReset();
+
+private:
+    static constexpr int PAGE_SIZE = 200;
+
+    QChar m_letter;
+    QVector<int> m_ids; // all ids of the bucket
+    int m_loaded = 0;   // rows exposed so far
+};
+
+#endif // WORDLISTMODEL_H
@@ -3,21 +3,31 @@
 #include "User_Files/UserStorage.h"
 #include "User_Files/UserDialog.h"
 #include "GUI/LoadingScreen.h" 
+#include "Function_Files/PersistenceWorker.h"
+#include "Word_Files/Word_Storage.h"
+#include "Function_Files/DataLoader.h"
 
 int main(int argc, char *argv[]) {
     QApplication a(argc, argv);
 
-    // Load existing users (file is users.json in cwd).
-    // If a previous user was saved, they will be set as the current user here.
-    UserStorage::instance().load("users.json");
+    // Start the persistence thread from the GUI thread; loading queues writes.
+    PersistenceWorker::instance();
+    // Create the change feed here too, so it belongs to the GUI thread and
+    // not to the loader thread that first records to it.
+    WordStorage::changes();
 
-    // Show the custom loading screen with title and animated bar.
+    // Load users (users.json) and words (words.json) on a worker thread.
+    // The loading screen follows its real progress and closes when done.
+    DataLoader dataLoader;
     LoadingScreen loader;
-    
+
     QEventLoop loop;
+    QObject::connect(&dataLoader, &DataLoader::progress, &loader, &LoadingScreen::setProgress);
+    QObject::connect(&dataLoader, &DataLoader::finished, &loader, &LoadingScreen::finish);
     QObject::connect(&loader, &LoadingScreen::finished, &loop, &QEventLoop::quit);
-    loader.start(1400); 
-    loop.exec();        
+    dataLoader.start("users.json", "words.json");
+    loader.start();
+    loop.exec();
 
     // Show a modal dialog to collect user name and age (user can cancel).
     // Only show the UserDialog if no user is currently set.
@@ -31,5 +41,9 @@ int main(int argc, char *argv[]) {
     Gui_Holder w;
     w.show();
 
-    return a.exec();
+    int result = a.exec();
+
+    // Write out anything still queued before the process exits.
+    PersistenceWorker::instance().shutdown();
+    return result;
 }
\ No newline at end of file
@@ -46,6 +46,8 @@
 #include <QTimer>
 #include <QDialogButtonBox>
 #include <QSpinBox>     
+#include <QCompleter>
+#include <QStringListModel>
 
 // --- Qt Graphics/Painting Headers ---
 #include <QPainter>     
@@ -1,5 +1,6 @@
 #include "User_Files/UserStorage.h"
 #include "User_Files/User.h" 
+#include "Function_Files/PersistenceWorker.h"
 #include "Qt_includes.h"
 
 UserStorage &UserStorage::instance()
@@ -49,12 +50,10 @@ bool UserStorage::save(const QString &indexPath)
     }
     QJsonObject root;
     root["users"] = arr;
-    QJsonDocument doc(root);
-    QFile f(path);
-    QDir().mkpath(QFileInfo(path).absolutePath());
-    if (!f.open(QIODevice::WriteOnly | QIODevice::Text)) return false;
-    f.write(doc.toJson(QJsonDocument::Indented));
-    f.close();
+    // Written on the persistence thread from this snapshot of the index.
+    PersistenceWorker::instance().write(path, [root]() {
+        return QJsonDocument(root).toJson(QJsonDocument::Indented);
+    });
     QDir().mkpath("users");
     return true;
 }
@@ -117,7 +116,8 @@ bool UserStorage::removeUser(const QString &username)
     m_userIndex.remove(username);
     m_userDataCache.remove(username);
     save();
-    QFile::remove(QString("users/%1.json").arg(username));
+    // Queued so it cannot race a pending write of the same file.
+    PersistenceWorker::instance().remove(QString("users/%1.json").arg(username));
     if (m_currentUser == username) m_currentUser.clear();
     return true;
 }
@@ -141,6 +141,9 @@ bool UserStorage::loadUserData(const QString &username)
 {
     if (!hasUser(username)) return false;
     QString file = QString("users/%1.json").arg(username);
+    // A queued write of this user's file was made from the cache, so the
+    // cache is at least as new as the file: use it instead of waiting.
+    if (m_userDataCache.contains(username) && PersistenceWorker::instance().isPending(file)) return true;
     QFile f(file);
     if (!f.exists()) {
         // create empty
@@ -162,12 +165,10 @@ bool UserStorage::saveUserData(const QString &username) const
     if (!m_userIndex.contains(username)) return false;
     QString file = QString("users/%1.json").arg(username);
     QJsonObject data = m_userDataCache.value(username, QJsonObject());
-    QJsonDocument doc(data);
-    QFile f(file);
-    QDir().mkpath(QFileInfo(file).absolutePath());
-    if (!f.open(QIODevice::WriteOnly | QIODevice::Text)) return false;
-    f.write(doc.toJson(QJsonDocument::Indented));
-    f.close();
+    // Written on the persistence thread from this snapshot of the data.
+    PersistenceWorker::instance().write(file, [data]() {
+        return QJsonDocument(data).toJson(QJsonDocument::Indented);
+    });
     return true;
 }
 
@@ -13,7 +13,7 @@ public:
 
     // load / save index file (users.json)
     bool load(const QString &indexPath = QString("users.json")); // Loads the list of all users
-    bool save(const QString &indexPath = QString()); // Saves the list of all users
+    bool save(const QString &indexPath = QString()); // Queues a save of the list of all users
 
     // index operations
     QStringList users() const; // Returns a list of all usernames
@@ -28,7 +28,7 @@ public:
 
     // per-user data
     bool loadUserData(const QString &username); // Loads detailed JSON data for a specific user
-    bool saveUserData(const QString &username) const; // Saves detailed JSON data for a specific user
+    bool saveUserData(const QString &username) const; // Queues a save of detailed JSON data for a specific user
     bool saveCurrentUserData() const; // Saves data for the currently active user
 
     QJsonObject currentUserData() const; // Returns the detailed JSON data for the current user
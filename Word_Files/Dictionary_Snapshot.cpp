@@ -0,0 +1,160 @@
+#include "Word_Files/Dictionary_Snapshot.h"
+#include "Word_Files/Word_Storage.h"
+#include <QFileInfo>
+#include <QDateTime>
+#include <cstring>
+
+namespace {
+const char MAGIC[8] = { 'D', 'L', 'W', 'O', 'R', 'D', 'S', '\0' };
+}
+
+const QChar DictionarySnapshot::LIST_SEPARATOR = QChar(0x1F); // ASCII unit separator
+
+DictionarySnapshot::~DictionarySnapshot()
+{
+    if (m_header) m_file.unmap(reinterpret_cast<uchar *>(const_cast<Header *>(m_header)));
+}
+
+bool DictionarySnapshot::open(const QString &path)
+{
+    m_file.setFileName(path);
+    if (!m_file.open(QIODevice::ReadOnly)) return false;
+
+    const qint64 size = m_file.size();
+    if (size < qint64(sizeof(Header))) return false;
+
+    uchar *data = m_file.map(0, size);
+    if (!data) return false;
+
+    const Header *h = reinterpret_cast<const Header *>(data);
+    const quint64 recordsEnd = sizeof(Header) + quint64(h->count) * sizeof(Record);
+    const bool valid = std::memcmp(h->magic, MAGIC, sizeof(MAGIC)) == 0
+        && h->version == FORMAT_VERSION
+        && recordsEnd <= h->stringsOffset
+        && h->stringsOffset % sizeof(char16_t) == 0
+        && h->stringsOffset + h->stringsLength * sizeof(char16_t) <= h->indexesOffset
+        && h->indexesOffset % sizeof(quint64) == 0
+        && h->indexesOffset <= quint64(size) && h->indexesLength <= quint64(size) - h->indexesOffset
+        && m_indexes.attach(MappedBlock{ reinterpret_cast<const char *>(data + h->indexesOffset), h->indexesLength })
+        && m_indexes.count() == IndexCount;
+    if (!valid) {
+        m_indexes = MappedBlockSet();
+        m_file.unmap(data);
+        return false;
+    }
+
+    m_header = h;
+    m_records = reinterpret_cast<const Record *>(data + sizeof(Header));
+    m_strings = reinterpret_cast<const char16_t *>(data + h->stringsOffset);
+    return true;
+}
+
+bool DictionarySnapshot::isCurrentFor(const QString &sourcePath) const
+{
+    if (!m_header) return false;
+    const QFileInfo info(sourcePath);
+    return info.exists()
+        && info.size() == m_header->sourceSize
+        && info.lastModified().toMSecsSinceEpoch() == m_header->sourceModified;
+}
+
+int DictionarySnapshot::count() const
+{
+    return m_header ? int(m_header->count) : 0;
+}
+
+QString DictionarySnapshot::field(int id, Field f) const
+{
+    if (id < 0 || id >= count()) return QString();
+    const Record &r = m_records[id];
+    // Guard against a corrupt record pointing outside the string table.
+    if (quint64(r.offset[f]) + r.length[f] > m_header->stringsLength) return QString();
+    return QString(reinterpret_cast<const QChar *>(m_strings + r.offset[f]), r.length[f]);
+}
+
+WordEntry DictionarySnapshot::entry(int id) const
+{
+    auto list = [this, id](Field f) {
+        const QString joined = field(id, f);
+        return joined.isEmpty() ? QStringList() : joined.split(LIST_SEPARATOR);
+    };
+
+    WordEntry e;
+    e.word = field(id, Word);
+    e.definition = field(id, Definition);
+    e.synonyms = list(Synonyms);
+    e.antonyms = list(Antonyms);
+    e.background = field(id, Background);
+    e.usage = field(id, Usage);
+    e.translation = field(id, Translation);
+    return e;
+}
+
+QByteArray DictionarySnapshot::serialize(const QVector<WordEntry> &words, const QString &sourcePath)
+{
+    const QFileInfo source(sourcePath);
+
+    Header h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic, MAGIC, sizeof(MAGIC));
+    h.version = FORMAT_VERSION;
+    h.count = quint32(words.size());
+    h.sourceSize = source.size();
+    h.sourceModified = source.lastModified().toMSecsSinceEpoch();
+    h.stringsOffset = sizeof(Header) + quint64(words.size()) * sizeof(Record);
+
+    QVector<Record> records(words.size());
+    QString strings;
+    // Two passes: the hot fields of every entry, then the cold ones.
+    for (const auto &tier : { qMakePair(0, HotFieldCount), qMakePair(HotFieldCount, int(FieldCount)) }) {
+        for (int i = 0; i < words.size(); ++i) {
+            const WordEntry &e = words.at(i);
+            const QString values[FieldCount] = {
+                e.word, e.definition,
+                e.synonyms.join(LIST_SEPARATOR), e.antonyms.join(LIST_SEPARATOR),
+                e.background, e.usage, e.translation
+            };
+            for (int f = tier.first; f < tier.second; ++f) {
+                records[i].offset[f] = quint32(strings.size());
+                records[i].length[f] = quint32(values[f].size());
+                strings += values[f];
+            }
+        }
+    }
+    h.stringsLength = quint64(strings.size());
+
+    // Indexes over the same ids, built the way WordStorage builds them: the
+    // first of several equal words is the one links resolve to.
+    QHash<QString, int> wordIndex;
+    wordIndex.reserve(words.size());
+    for (int i = 0; i < words.size(); ++i) {
+        const QString key = WordStorage::foldKey(words.at(i).word);
+        if (!wordIndex.contains(key)) wordIndex.insert(key, i);
+    }
+    TextIndex text;
+    RelationIndex relations;
+    TranslationIndex translations;
+    for (int i = 0; i < words.size(); ++i) {
+        text.add(i, words.at(i));
+        relations.add(i, words.at(i), wordIndex);
+        translations.add(i, words.at(i));
+    }
+    QVector<QByteArray> indexes(IndexCount);
+    indexes[TextIndexData] = text.serialize();
+    indexes[RelationIndexData] = relations.serialize();
+    indexes[TranslationIndexData] = translations.serialize();
+    const QByteArray indexBlocks = MappedBlockSet::serialize(indexes);
+
+    const quint64 stringsEnd = h.stringsOffset + h.stringsLength * sizeof(char16_t);
+    h.indexesOffset = MappedBlockSet::padded(stringsEnd);
+    h.indexesLength = quint64(indexBlocks.size());
+
+    QByteArray out;
+    out.reserve(qsizetype(h.indexesOffset + h.indexesLength));
+    out.append(reinterpret_cast<const char *>(&h), sizeof(h));
+    out.append(reinterpret_cast<const char *>(records.constData()), records.size() * sizeof(Record));
+    out.append(reinterpret_cast<const char *>(strings.utf16()), strings.size() * sizeof(char16_t));
+    out.append(QByteArray(int(h.indexesOffset - stringsEnd), '\0'));
+    out.append(indexBlocks);
+    return out;
+}
@@ -0,0 +1,93 @@
+#ifndef DICTIONARY_SNAPSHOT_H
+#define DICTIONARY_SNAPSHOT_H
+
+#include <QString>
+#include <QVector>
+#include <QFile>
+#include <QByteArray>
+#include "Word_Files/Mapped_Table.h"
+
+struct WordEntry;
+
+// Read-only, memory-mapped binary copy of the dictionary (words.json.<serial>.bin).
+//
+// Layout (native byte order, versioned by FORMAT_VERSION):
+//   Header                          fixed size, see below
+//   Record[count]                   per entry: offset and length of each field
+//   char16_t strings[stringsLength] every field's UTF-16 text, back to back
+//   indexes                         a MappedBlockSet, one block per Index
+//
+// Nothing is parsed when the file is opened; a field is decoded into a
+// QString only when it is asked for. Synonym and antonym lists are stored
+// as one string joined by LIST_SEPARATOR.
+//
+// The string table is split in two tiers: every entry's word and definition
+// come first, the remaining (cold) fields after them. Browsing and lookups
+// only page in the hot tier; the rest is read when an entry is opened.
+// The indexes built from the cold fields (full text, synonyms and antonyms,
+// translations) are stored too and read in place, so loading a snapshot
+// does not decode them.
+//
+// The header records the size and modification time of the JSON file the
+// snapshot was made from, so a JSON file edited by hand makes it stale.
+class DictionarySnapshot {
+public:
+    // Fields before HotFieldCount are stored in the hot tier.
+    enum Field { Word, Definition, Synonyms, Antonyms, Background, Usage, Translation, FieldCount };
+    static const int HotFieldCount = Definition + 1;
+
+    DictionarySnapshot() = default;
+    ~DictionarySnapshot();
+    DictionarySnapshot(const DictionarySnapshot &) = delete;
+    DictionarySnapshot &operator=(const DictionarySnapshot &) = delete;
+
+    // Maps `path` and validates its header. Returns false if the file is
+    // missing, truncated or written by another format version.
+    bool open(const QString &path);
+    bool isOpen() const { return m_header != nullptr; }
+
+    // True if the snapshot was made from `sourcePath` as it is now on disk.
+    bool isCurrentFor(const QString &sourcePath) const;
+
+    int count() const;
+    QString field(int id, Field f) const;
+    WordEntry entry(int id) const;
+
+    // Stored indexes over every entry, for TextIndex, RelationIndex and
+    // TranslationIndex::attach().
+    enum Index { TextIndexData, RelationIndexData, TranslationIndexData, IndexCount };
+    MappedBlock index(Index i) const { return m_indexes.block(i); }
+
+    // Encodes `words` and their indexes in the snapshot format, stamped with
+    // the current size and modification time of `sourcePath`.
+    static QByteArray serialize(const QVector<WordEntry> &words, const QString &sourcePath);
+
+    static const QChar LIST_SEPARATOR;
+
+private:
+    static const quint32 FORMAT_VERSION = 3;
+
+    struct Header {
+        char magic[8];          // "DLWORDS\0"
+        quint32 version;
+        quint32 count;
+        qint64 sourceSize;
+        qint64 sourceModified;  // ms since epoch
+        quint64 stringsOffset;  // bytes from the start of the file
+        quint64 stringsLength;  // UTF-16 code units
+        quint64 indexesOffset;  // bytes from the start of the file
+        quint64 indexesLength;  // bytes
+    };
+    struct Record {
+        quint32 offset[FieldCount]; // code units from the start of the strings
+        quint32 length[FieldCount];
+    };
+
+    QFile m_file;
+    const Header *m_header = nullptr;
+    const Record *m_records = nullptr;
+    const char16_t *m_strings = nullptr;
+    MappedBlockSet m_indexes;
+};
+
+#endif // DICTIONARY_SNAPSHOT_H
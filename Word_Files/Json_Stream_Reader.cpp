@@ -0,0 +1,117 @@
+#include "Word_Files/Json_Stream_Reader.h"
+#include <QIODevice>
+
+namespace {
+bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; }
+}
+
+bool JsonStreamReader::readNextRaw(QByteArray &json)
+{
+    while (!m_finished && !m_error) {
+        // Drop consumed input so the buffer only ever holds one element.
+        if (m_pos > 0) {
+            m_buffer.remove(0, m_pos);
+            m_pos = 0;
+        }
+
+        char c;
+        while (peek(c) && (isSpace(c) || (m_started && c == ','))) ++m_pos;
+        if (!peek(c)) {
+            // Truncated file: the array was never closed.
+            m_error = true;
+            break;
+        }
+
+        if (!m_started) {
+            // Tolerate a UTF-8 byte order mark, as QJsonDocument does.
+            if (m_buffer.startsWith("\xEF\xBB\xBF")) {
+                m_pos += 3;
+                continue;
+            }
+            if (c != '[') {
+                m_error = true;
+                break;
+            }
+            m_started = true;
+            ++m_pos;
+            continue;
+        }
+
+        if (c == ']') {
+            m_finished = true;
+            ++m_pos;
+            break;
+        }
+
+        const qsizetype start = m_pos;
+        if (!skipValue()) {
+            m_error = true;
+            break;
+        }
+        if (c != '{') continue;
+
+        json = m_buffer.sliced(start, m_pos - start);
+        return true;
+    }
+    return false;
+}
+
+// Makes sure m_buffer[m_pos] is available and returns it in `c`.
+bool JsonStreamReader::peek(char &c)
+{
+    if (m_pos >= m_buffer.size() && !fill()) return false;
+    c = m_buffer.at(m_pos);
+    return true;
+}
+
+bool JsonStreamReader::fill()
+{
+    const QByteArray chunk = m_device->read(CHUNK_SIZE);
+    if (chunk.isEmpty()) return false;
+    m_buffer += chunk;
+    m_bytesRead += chunk.size();
+    return true;
+}
+
+// Advances m_pos past the value that starts there. Only brackets and string
+// boundaries are tracked; the contents are validated by QJsonDocument.
+bool JsonStreamReader::skipValue()
+{
+    int depth = 0;
+    bool inString = false;
+    bool escaped = false;
+    char c;
+    while (peek(c)) {
+        ++m_pos;
+        if (inString) {
+            if (escaped) escaped = false;
+            else if (c == '\\') escaped = true;
+            else if (c == '"') {
+                inString = false;
+                if (depth == 0) return true;
+            }
+            continue;
+        }
+        switch (c) {
+        case '"':
+            inString = true;
+            break;
+        case '{':
+        case '[':
+            ++depth;
+            break;
+        case '}':
+        case ']':
+            if (--depth <= 0) return depth == 0;
+            break;
+        default:
+            if (depth == 0) {
+                // Number, true, false or null: runs up to the next delimiter.
+                while (peek(c) && !isSpace(c) && c != ',' && c != ']' && c != '}') ++m_pos;
+                return true;
+            }
+            break;
+        }
+    }
+    return false;
+}
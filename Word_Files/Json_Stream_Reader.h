@@ -0,0 +1,46 @@
+#ifndef JSON_STREAM_READER_H
+#define JSON_STREAM_READER_H
+
+#include <QByteArray>
+
+class QIODevice;
+
+// Reads a top-level JSON array of objects (the words.json layout) one element
+// at a time. The device is read in fixed-size chunks and only the element
+// being parsed is buffered, so memory stays bounded by the largest entry
+// instead of growing with the file. The caller hands each element to
+// QJsonDocument, so string escapes and numbers parse exactly as before.
+class JsonStreamReader {
+public:
+    explicit JsonStreamReader(QIODevice *device) : m_device(device) {}
+
+    // Reads the next object of the array as its unparsed JSON text, so the
+    // caller can parse batches of elements on several threads. Returns false
+    // at the end of the array or on malformed input; see hasError(). Only
+    // the array structure is checked here, and elements that are not
+    // objects are skipped.
+    bool readNextRaw(QByteArray &json);
+
+    bool hasError() const { return m_error; }
+    // True once the closing ']' has been read.
+    bool atEnd() const { return m_finished; }
+    // Bytes taken from the device so far, for progress reporting.
+    qint64 bytesRead() const { return m_bytesRead; }
+
+private:
+    bool peek(char &c);
+    bool fill();
+    bool skipValue();
+
+    static const qint64 CHUNK_SIZE = 64 * 1024;
+
+    QIODevice *m_device;
+    QByteArray m_buffer; // unconsumed input, starting at the current element
+    qsizetype m_pos = 0; // read position in m_buffer
+    qint64 m_bytesRead = 0;
+    bool m_started = false; // the opening '[' has been read
+    bool m_finished = false;
+    bool m_error = false;
+};
+
+#endif // JSON_STREAM_READER_H
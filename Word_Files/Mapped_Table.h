@@ -0,0 +1,214 @@
+#ifndef MAPPED_TABLE_H
+#define MAPPED_TABLE_H
+
+#include <QString>
+#include <QStringView>
+#include <QByteArray>
+#include <QVector>
+#include <QPair>
+#include <cstring>
+#include <type_traits>
+
+// Index data that DictionarySnapshot stores next to the entries and that the
+// indexes read in place from the mapping, so loading a snapshot neither
+// decodes the entries nor copies the indexes into memory.
+
+// A byte range inside a mapped file, valid for as long as the mapping is.
+struct MappedBlock {
+    const char *data = nullptr;
+    quint64 size = 0;
+
+    bool isNull() const { return data == nullptr; }
+
+    // The block as an array of T, or null if its size does not fit one.
+    template <typename T>
+    const T *array(quint64 count) const {
+        return data && size == count * sizeof(T) ? reinterpret_cast<const T *>(data) : nullptr;
+    }
+};
+
+// Several blocks stored as one:
+//   quint64 count
+//   quint64 offset[count], size[count]   bytes from the start of the set
+//   blocks, each padded to 8 bytes
+class MappedBlockSet {
+public:
+    // Uses `block` in place. Returns false if it is not a consistent set.
+    bool attach(const MappedBlock &block)
+    {
+        m_set = MappedBlock();
+        if (block.isNull() || block.size < sizeof(quint64)
+            || reinterpret_cast<quintptr>(block.data) % alignof(quint64) != 0) {
+            return false;
+        }
+        const quint64 *header = reinterpret_cast<const quint64 *>(block.data);
+        const quint64 count = header[0];
+        if (count > (block.size / sizeof(quint64) - 1) / 2) return false;
+        for (quint64 i = 0; i < count; ++i) {
+            const quint64 offset = header[1 + i];
+            const quint64 size = header[1 + count + i];
+            if (offset % alignof(quint64) != 0 || offset > block.size || size > block.size - offset) {
+                return false;
+            }
+        }
+        m_set = block;
+        return true;
+    }
+
+    int count() const { return m_set.isNull() ? 0 : int(header()[0]); }
+
+    MappedBlock block(int i) const
+    {
+        if (i < 0 || i >= count()) return MappedBlock();
+        const quint64 n = header()[0];
+        return MappedBlock{ m_set.data + header()[1 + i], header()[1 + n + i] };
+    }
+
+    static QByteArray serialize(const QVector<QByteArray> &blocks)
+    {
+        const quint64 count = quint64(blocks.size());
+        QVector<quint64> header(int(1 + 2 * count));
+        header[0] = count;
+        quint64 offset = quint64(header.size()) * sizeof(quint64);
+        for (int i = 0; i < blocks.size(); ++i) {
+            header[1 + i] = offset;
+            header[1 + count + i] = quint64(blocks.at(i).size());
+            offset += padded(quint64(blocks.at(i).size()));
+        }
+
+        QByteArray out;
+        out.reserve(qsizetype(offset));
+        out.append(reinterpret_cast<const char *>(header.constData()), header.size() * sizeof(quint64));
+        for (const QByteArray &b : blocks) {
+            out.append(b);
+            out.append(QByteArray(int(padded(quint64(b.size())) - quint64(b.size())), '\0'));
+        }
+        return out;
+    }
+
+    // The raw bytes of `count` values of T, for a block of the set.
+    template <typename T>
+    static QByteArray fromArray(const T *values, int count)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "stored as raw bytes");
+        return QByteArray(reinterpret_cast<const char *>(values), count * int(sizeof(T)));
+    }
+
+    static quint64 padded(quint64 size) { return (size + 7) & ~quint64(7); }
+
+private:
+    const quint64 *header() const { return reinterpret_cast<const quint64 *>(m_set.data); }
+
+    MappedBlock m_set;
+};
+
+// Read-only map from strings to runs of T, read in place from a block:
+//   Key[keyCount]               sorted by key (UTF-16 code unit order)
+//   T values[]                  each key's run, back to back
+//   char16_t text[]             every key's text, back to back
+// stored as the three blocks of a MappedBlockSet.
+template <typename T>
+class MappedTable {
+    static_assert(std::is_trivially_copyable<T>::value, "stored as raw bytes");
+public:
+    // A run of values, valid for as long as the mapping is.
+    struct Run {
+        const T *first = nullptr;
+        int size = 0;
+
+        const T *begin() const { return first; }
+        const T *end() const { return first + size; }
+        const T &at(int i) const { return first[i]; }
+        bool isEmpty() const { return size == 0; }
+    };
+
+    bool attach(const MappedBlock &block)
+    {
+        detach();
+        MappedBlockSet set;
+        if (!set.attach(block) || set.count() != 3) return false;
+        const MappedBlock keys = set.block(0), values = set.block(1), text = set.block(2);
+        if (keys.size % sizeof(Key) != 0 || values.size % sizeof(T) != 0 || text.size % sizeof(char16_t) != 0) {
+            return false;
+        }
+        m_keys = reinterpret_cast<const Key *>(keys.data);
+        m_keyCount = int(keys.size / sizeof(Key));
+        m_values = reinterpret_cast<const T *>(values.data);
+        m_valueCount = values.size / sizeof(T);
+        m_text = reinterpret_cast<const char16_t *>(text.data);
+        m_textLength = text.size / sizeof(char16_t);
+        return true;
+    }
+
+    void detach() { *this = MappedTable(); }
+    bool isAttached() const { return m_keys != nullptr; }
+    int keyCount() const { return m_keyCount; }
+
+    // Position of `key` in key order, or -1.
+    int indexOf(QStringView key) const
+    {
+        int lo = 0, hi = m_keyCount;
+        while (lo < hi) {
+            const int mid = lo + (hi - lo) / 2;
+            if (keyAt(mid) < key) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo < m_keyCount && keyAt(lo) == key ? lo : -1;
+    }
+
+    // Key text and values at a position; empty if the table is corrupt there.
+    QStringView keyAt(int index) const
+    {
+        if (index < 0 || index >= m_keyCount) return QStringView();
+        const Key &k = m_keys[index];
+        if (quint64(k.textOffset) + k.textLength > m_textLength) return QStringView();
+        return QStringView(m_text + k.textOffset, qsizetype(k.textLength));
+    }
+
+    Run valuesAt(int index) const
+    {
+        if (index < 0 || index >= m_keyCount) return Run();
+        const Key &k = m_keys[index];
+        if (quint64(k.valueOffset) + k.valueCount > m_valueCount) return Run();
+        return Run{ m_values + k.valueOffset, int(k.valueCount) };
+    }
+
+    Run values(QStringView key) const { return valuesAt(indexOf(key)); }
+
+    // Encodes `items`, which must be sorted by key with no key twice.
+    static QByteArray serialize(const QVector<QPair<QString, QVector<T>>> &items)
+    {
+        QVector<Key> keys;
+        keys.reserve(items.size());
+        QVector<T> values;
+        QString text;
+        for (const auto &item : items) {
+            keys.append(Key{ quint32(text.size()), quint32(item.first.size()),
+                             quint32(values.size()), quint32(item.second.size()) });
+            text += item.first;
+            values += item.second;
+        }
+        return MappedBlockSet::serialize({
+            MappedBlockSet::fromArray(keys.constData(), keys.size()),
+            MappedBlockSet::fromArray(values.constData(), values.size()),
+            MappedBlockSet::fromArray(reinterpret_cast<const char16_t *>(text.utf16()), text.size()),
+        });
+    }
+
+private:
+    struct Key {
+        quint32 textOffset;  // code units from the start of the text
+        quint32 textLength;
+        quint32 valueOffset; // values from the start of the values
+        quint32 valueCount;
+    };
+
+    const Key *m_keys = nullptr;
+    int m_keyCount = 0;
+    const T *m_values = nullptr;
+    quint64 m_valueCount = 0;
+    const char16_t *m_text = nullptr;
+    quint64 m_textLength = 0;
+};
+
+#endif // MAPPED_TABLE_H
@@ -0,0 +1,152 @@
+#include "Word_Files/Prefix_Index.h"
+#include <QStringView>
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace {
+struct KeyLess {
+    template <typename Item>
+    bool operator()(const Item &item, const QString &key) const { return item.key < key; }
+};
+}
+
+void PrefixIndex::insert(const QString &key, int id)
+{
+    auto pos = std::lower_bound(m_recent.begin(), m_recent.end(), key, KeyLess());
+    m_recent.insert(pos, Item{key, id});
+    if (m_recent.size() < MERGE_AT) return;
+
+    // Ties keep the older key first, as a sorted insert would.
+    QVector<Item> merged;
+    merged.reserve(m_items.size() + m_recent.size());
+    std::merge(std::make_move_iterator(m_items.begin()), std::make_move_iterator(m_items.end()),
+               std::make_move_iterator(m_recent.begin()), std::make_move_iterator(m_recent.end()),
+               std::back_inserter(merged),
+               [](const Item &a, const Item &b) { return a.key < b.key; });
+    m_items = std::move(merged);
+    m_recent.clear();
+}
+
+void PrefixIndex::build(QVector<QPair<QString, int>> items)
+{
+    m_recent.clear();
+    m_items.clear();
+    m_items.reserve(items.size());
+    for (auto &p : items) m_items.append(Item{std::move(p.first), p.second});
+    std::sort(m_items.begin(), m_items.end(), [](const Item &a, const Item &b) {
+        return a.key < b.key;
+    });
+}
+
+QVector<int> PrefixIndex::complete(const QString &prefix, int limit) const
+{
+    QVector<int> out;
+    if (prefix.isEmpty() || limit <= 0) return out;
+
+    // Walk the matching runs of both arrays together, in key order.
+    auto a = std::lower_bound(m_items.cbegin(), m_items.cend(), prefix, KeyLess());
+    auto b = std::lower_bound(m_recent.cbegin(), m_recent.cend(), prefix, KeyLess());
+    const auto aEnd = m_items.cend();
+    const auto bEnd = m_recent.cend();
+    while (out.size() < limit) {
+        const bool aIn = a != aEnd && a->key.startsWith(prefix);
+        const bool bIn = b != bEnd && b->key.startsWith(prefix);
+        if (!aIn && !bIn) break;
+        if (aIn && (!bIn || !(b->key < a->key))) out.append((a++)->id);
+        else out.append((b++)->id);
+    }
+    return out;
+}
+
+QVector<QPair<int, int>> PrefixIndex::fuzzy(const QString &query, int maxDistance) const
+{
+    const auto a = fuzzyIn(m_items, query, maxDistance);
+    const auto b = fuzzyIn(m_recent, query, maxDistance);
+
+    QVector<QPair<int, int>> out;
+    out.reserve(a.size() + b.size());
+    int i = 0;
+    int j = 0;
+    while (i < a.size() || j < b.size()) {
+        const bool takeA = j == b.size()
+            || (i < a.size() && !(m_recent.at(b.at(j).first).key < m_items.at(a.at(i).first).key));
+        if (takeA) {
+            out.append(qMakePair(m_items.at(a.at(i).first).id, a.at(i).second));
+            ++i;
+        } else {
+            out.append(qMakePair(m_recent.at(b.at(j).first).id, b.at(j).second));
+            ++j;
+        }
+    }
+    return out;
+}
+
+QVector<QPair<int, int>> PrefixIndex::fuzzyIn(const QVector<Item> &items, const QString &query, int maxDistance)
+{
+    QVector<QPair<int, int>> out;
+    const int m = query.size();
+    if (m == 0 || maxDistance < 0) return out;
+
+    // rows[j * width + k] is the distance between the first j characters of
+    // the current key and the first k characters of the query.
+    const int width = m + 1;
+    std::vector<int> rows(width);
+    for (int k = 0; k <= m; ++k) rows[k] = k;
+
+    int prev = -1;     // key whose rows are cached
+    int prevDepth = 0; // number of valid rows for that key (beyond row 0)
+
+    int i = 0;
+    const int n = items.size();
+    while (i < n) {
+        const QString &key = items.at(i).key;
+
+        // Rows for the prefix shared with the previous key are still valid.
+        int depth = 0;
+        if (prev >= 0) {
+            const QString &pk = items.at(prev).key;
+            const int limit = std::min<int>(prevDepth, key.size());
+            while (depth < limit && pk.at(depth) == key.at(depth)) ++depth;
+        }
+
+        rows.resize(size_t(key.size() + 1) * width);
+        bool pruned = false;
+        for (int j = depth + 1; j <= key.size(); ++j) {
+            const int *above = &rows[size_t(j - 1) * width];
+            int *row = &rows[size_t(j) * width];
+            const QChar c = key.at(j - 1);
+
+            row[0] = j;
+            int best = j;
+            for (int k = 1; k <= m; ++k) {
+                const int cost = query.at(k - 1) == c ? 0 : 1;
+                row[k] = std::min({above[k] + 1, row[k - 1] + 1, above[k - 1] + cost});
+                best = std::min(best, row[k]);
+            }
+
+            if (best > maxDistance) {
+                // No key starting with this prefix can match: skip the run.
+                const QStringView prefix = QStringView(key).left(j);
+                auto next = std::partition_point(items.cbegin() + i, items.cend(),
+                    [&prefix](const Item &item) {
+                        const QStringView k(item.key);
+                        return k < prefix || k.startsWith(prefix);
+                    });
+                prev = i;
+                prevDepth = j - 1;
+                i = int(next - items.cbegin());
+                pruned = true;
+                break;
+            }
+        }
+        if (pruned) continue;
+
+        const int distance = rows[size_t(key.size()) * width + m];
+        if (distance <= maxDistance) out.append(qMakePair(i, distance));
+        prev = i;
+        prevDepth = key.size();
+        ++i;
+    }
+    return out;
+}
@@ -0,0 +1,53 @@
+#ifndef PREFIX_INDEX_H
+#define PREFIX_INDEX_H
+
+#include <QString>
+#include <QVector>
+#include <QPair>
+
+// Sorted array of folded keys used for prefix completion.
+// A completion is a binary search for the first key >= prefix followed by a
+// walk over the contiguous run of keys that start with it, so top-k lookups
+// cost O(log n + k) regardless of dictionary size.
+//
+// Single inserts go to a small sorted side array that is merged into the
+// main one once it reaches MERGE_AT keys, so an insert does not move the
+// whole array; queries read both.
+class PrefixIndex {
+public:
+    void clear() { m_items.clear(); m_recent.clear(); }
+
+    // Inserts one key. Keys must already be folded.
+    void insert(const QString &key, int id);
+
+    // Replaces the contents with `items` in one sort instead of n inserts.
+    void build(QVector<QPair<QString, int>> items);
+
+    // Returns up to `limit` ids whose key starts with `prefix`, in key order.
+    QVector<int> complete(const QString &prefix, int limit) const;
+
+    // Returns (id, edit distance) for every key within `maxDistance`
+    // Levenshtein edits of `query`, in key order. The sorted array is walked
+    // as an implicit trie: DP rows are shared between keys with a common
+    // prefix, and a whole run of keys is skipped as soon as its prefix can no
+    // longer come back within range.
+    QVector<QPair<int, int>> fuzzy(const QString &query, int maxDistance) const;
+
+    int size() const { return m_items.size() + m_recent.size(); }
+
+private:
+    struct Item {
+        QString key;
+        int id;
+    };
+
+    // (position in `items`, distance) for the keys of `items` within range.
+    static QVector<QPair<int, int>> fuzzyIn(const QVector<Item> &items, const QString &query, int maxDistance);
+
+    static const int MERGE_AT = 4096;
+
+    QVector<Item> m_items;  // sorted by key
+    QVector<Item> m_recent; // sorted by key, inserted since the last merge
+};
+
+#endif // PREFIX_INDEX_H
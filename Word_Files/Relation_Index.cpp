@@ -0,0 +1,235 @@
+#include "Word_Files/Relation_Index.h"
+#include "Word_Files/Word_Storage.h"
+#include <QSet>
+#include <algorithm>
+
+namespace {
+// Blocks of a stored graph: see the members they are attached to.
+enum StoredBlock { LinkStarts, Edges, Keys, Reverse, StoredBlockCount };
+}
+
+void RelationIndex::clear()
+{
+    m_keys.clear();
+    m_links.clear();
+    m_reverse.clear();
+    m_relatedCache.clear();
+    m_baseLinkStart = nullptr;
+    m_baseEdges = nullptr;
+    m_baseKeys = nullptr;
+    m_baseReverse.detach();
+    m_baseCount = 0;
+    m_resolved.clear();
+}
+
+void RelationIndex::add(int id, const WordEntry &entry, const QHash<QString, int> &wordIndex)
+{
+    const int slot = id - m_baseCount;
+    if (m_links.size() <= slot) {
+        m_links.resize(slot + 1);
+        m_keys.resize(slot + 1);
+    }
+
+    const QString key = WordStorage::foldKey(entry.word);
+    m_keys[slot] = key;
+
+    // Earlier entries may already list this word: resolve those links now,
+    // unless they already point at an earlier entry with the same word.
+    for (const Source &src : m_baseReverse.values(key)) {
+        if (src.link >= 0 && src.link < linkCount(src.id) && edge(src.id, src.link).target < 0) {
+            m_resolved.insert(linkKey(src.id, src.link), id);
+        }
+    }
+    auto waiting = m_reverse.constFind(key);
+    if (waiting != m_reverse.constEnd()) {
+        for (const Source &src : waiting.value()) {
+            Edge &link = m_links[src.id - m_baseCount][src.link];
+            if (link.target < 0) link.target = id;
+        }
+    }
+
+    QVector<Edge> &links = m_links[slot];
+    auto addLinks = [&](const QStringList &words, Kind kind) {
+        for (const QString &w : words) {
+            const QString k = WordStorage::foldKey(w);
+            if (k.isEmpty()) continue;
+            m_reverse[k].append(Source{id, int(links.size())});
+            links.append(Edge{wordIndex.value(k, -1), kind});
+        }
+    };
+    addLinks(entry.synonyms, Synonym);
+    addLinks(entry.antonyms, Antonym);
+
+    m_relatedCache.clear();
+}
+
+bool RelationIndex::attach(const MappedBlock &block)
+{
+    clear();
+    MappedBlockSet set;
+    if (!set.attach(block) || set.count() != StoredBlockCount) return false;
+
+    const MappedBlock starts = set.block(LinkStarts);
+    const quint64 count = starts.size / sizeof(quint32);
+    if (count == 0) return false;
+    const quint32 *linkStart = starts.array<quint32>(count);
+    const Edge *edges = linkStart ? set.block(Edges).array<Edge>(linkStart[count - 1]) : nullptr;
+    const qint32 *keys = set.block(Keys).array<qint32>(count - 1);
+    if (!edges || !keys || !m_baseReverse.attach(set.block(Reverse))) {
+        m_baseReverse.detach();
+        return false;
+    }
+
+    m_baseLinkStart = linkStart;
+    m_baseEdges = edges;
+    m_baseKeys = keys;
+    m_baseCount = int(count - 1);
+    return true;
+}
+
+QByteArray RelationIndex::serialize() const
+{
+    Q_ASSERT(m_baseCount == 0);
+    QVector<quint32> linkStart;
+    linkStart.reserve(m_links.size() + 1);
+    QVector<Edge> edges;
+    for (const QVector<Edge> &links : m_links) {
+        linkStart.append(quint32(edges.size()));
+        edges += links;
+    }
+    linkStart.append(quint32(edges.size()));
+
+    // Every stored word gets a row, listed or not, so an entry finds the
+    // entries listing it through its own position.
+    QHash<QString, QVector<Source>> reverse = m_reverse;
+    for (const QString &key : m_keys) {
+        if (!key.isEmpty() && !reverse.contains(key)) reverse.insert(key, QVector<Source>());
+    }
+    QVector<QPair<QString, QVector<Source>>> rows;
+    rows.reserve(reverse.size());
+    for (auto it = reverse.constBegin(); it != reverse.constEnd(); ++it) rows.append(qMakePair(it.key(), it.value()));
+    std::sort(rows.begin(), rows.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+
+    QHash<QString, qint32> position;
+    position.reserve(rows.size());
+    for (int i = 0; i < rows.size(); ++i) position.insert(rows.at(i).first, i);
+    QVector<qint32> keys;
+    keys.reserve(m_keys.size());
+    for (const QString &key : m_keys) keys.append(position.value(key, -1));
+
+    return MappedBlockSet::serialize({
+        MappedBlockSet::fromArray(linkStart.constData(), linkStart.size()),
+        MappedBlockSet::fromArray(edges.constData(), edges.size()),
+        MappedBlockSet::fromArray(keys.constData(), keys.size()),
+        MappedTable<Source>::serialize(rows),
+    });
+}
+
+QString RelationIndex::key(int id) const
+{
+    if (id >= m_baseCount) return m_keys.at(id - m_baseCount);
+    return m_baseReverse.keyAt(m_baseKeys[id]).toString();
+}
+
+int RelationIndex::linkCount(int id) const
+{
+    if (id < 0) return 0;
+    if (id >= m_baseCount) {
+        const int slot = id - m_baseCount;
+        return slot < m_links.size() ? int(m_links.at(slot).size()) : 0;
+    }
+    // Guard against a corrupt file pointing outside the stored edges.
+    const quint32 first = m_baseLinkStart[id], last = m_baseLinkStart[id + 1];
+    return first <= last && last <= m_baseLinkStart[m_baseCount] ? int(last - first) : 0;
+}
+
+RelationIndex::Edge RelationIndex::edge(int id, int link) const
+{
+    if (id >= m_baseCount) return m_links.at(id - m_baseCount).at(link);
+
+    Edge e = m_baseEdges[m_baseLinkStart[id] + link];
+    if (e.target < 0) e.target = m_resolved.value(linkKey(id, link), -1);
+    return e;
+}
+
+// Entries listing `foldedWord`: the stored ones first, so ids ascend.
+QVector<RelationIndex::Source> RelationIndex::sources(const QString &foldedWord) const
+{
+    QVector<Source> out;
+    for (const Source &src : m_baseReverse.values(foldedWord)) {
+        if (src.link >= 0 && src.link < linkCount(src.id)) out.append(src);
+    }
+    out += m_reverse.value(foldedWord);
+    return out;
+}
+
+QVector<RelationIndex::Link> RelationIndex::links(int id, const WordEntry &entry) const
+{
+    QVector<Link> out;
+    const int count = linkCount(id);
+    if (count == 0) return out;
+
+    // Walks the lists in the order add() did, so edge i belongs to the i-th
+    // non-empty listed word.
+    out.reserve(count);
+    for (const QStringList *words : { &entry.synonyms, &entry.antonyms }) {
+        for (const QString &w : *words) {
+            if (WordStorage::foldKey(w).isEmpty()) continue;
+            if (out.size() >= count) return out;
+            const Edge e = edge(id, int(out.size()));
+            out.append(Link{w, e.target, e.kind});
+        }
+    }
+    return out;
+}
+
+QVector<int> RelationIndex::listedBy(const QString &foldedWord, Kind kind) const
+{
+    QVector<int> out;
+    for (const Source &src : sources(foldedWord)) {
+        if (edge(src.id, src.link).kind != kind) continue;
+        if (out.isEmpty() || out.last() != src.id) out.append(src.id);
+    }
+    return out;
+}
+
+// Synonym neighbours of `id`: the entries it lists plus the entries listing it.
+QVector<int> RelationIndex::neighbours(int id) const
+{
+    QVector<int> out;
+    if (id < 0 || id >= m_baseCount + m_links.size()) return out;
+
+    const int count = linkCount(id);
+    for (int link = 0; link < count; ++link) {
+        const Edge e = edge(id, link);
+        if (e.kind == Synonym && e.target >= 0) out.append(e.target);
+    }
+    out += listedBy(key(id), Synonym);
+    return out;
+}
+
+QVector<int> RelationIndex::related(int id, int maxHops) const
+{
+    const qint64 cacheKey = (qint64(id) << 8) | (maxHops & 0xFF);
+    auto cached = m_relatedCache.constFind(cacheKey);
+    if (cached != m_relatedCache.constEnd()) return cached.value();
+
+    QVector<int> out;
+    QSet<int> seen{id};
+    QVector<int> frontier{id};
+    for (int hop = 0; hop < maxHops && !frontier.isEmpty(); ++hop) {
+        QVector<int> next;
+        for (int current : frontier) {
+            for (int n : neighbours(current)) {
+                if (seen.contains(n)) continue;
+                seen.insert(n);
+                next.append(n);
+                out.append(n);
+            }
+        }
+        frontier = next;
+    }
+
+    if (m_cacheRelated) m_relatedCache.insert(cacheKey, out);
+    return out;
+}
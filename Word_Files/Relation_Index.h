@@ -0,0 +1,96 @@
+#ifndef RELATION_INDEX_H
+#define RELATION_INDEX_H
+
+#include <QString>
+#include <QVector>
+#include <QHash>
+#include <QByteArray>
+#include "Word_Files/Mapped_Table.h"
+
+struct WordEntry;
+
+// Synonym/antonym graph over the stored words.
+// Each listed synonym or antonym becomes a link that is resolved to the id of
+// the matching entry as soon as that entry exists (links to words that are
+// not stored yet stay unresolved until they are added). Reverse edges are
+// kept by folded word so "which words list X?" needs no scan.
+//
+// The graph of a dictionary snapshot is stored in it (serialize()) and read
+// in place from the mapping (attach()); entries added after it are indexed
+// in memory, and links they resolve in the stored part are kept aside.
+class RelationIndex {
+public:
+    enum Kind : qint32 { Synonym, Antonym }; // fixed size: stored in snapshots
+
+    struct Link {
+        QString text; // as listed in the entry
+        int target;   // id of the matching entry, or -1 if not stored
+        Kind kind;
+    };
+
+    // Only targets are kept per link; the listed text is a cold field that
+    // links() reads back from the entry.
+    struct Edge {
+        int target;
+        Kind kind;
+    };
+
+    void clear();
+
+    // Indexes the links of one entry. `wordIndex` maps folded words to ids
+    // and must already contain `entry` itself.
+    void add(int id, const WordEntry &entry, const QHash<QString, int> &wordIndex);
+
+    // Starts from the graph stored in a snapshot, covering ids
+    // [0, its entry count). Must be called on an empty index. Returns false,
+    // leaving the index empty, if the block does not hold one.
+    bool attach(const MappedBlock &block);
+
+    // Encodes the graph for attach(). Only an index that was filled by add()
+    // alone can be stored.
+    QByteArray serialize() const;
+
+    // Links listed by entry `id` (which must be `entry`), synonyms first.
+    QVector<Link> links(int id, const WordEntry &entry) const;
+
+    // Ids of the entries that list `foldedWord` with the given kind.
+    QVector<int> listedBy(const QString &foldedWord, Kind kind) const;
+
+    // Ids reachable from `id` over synonym edges (both directions) within
+    // `maxHops`, nearest first, excluding `id` itself. Results are cached
+    // until the next add(), unless caching is off.
+    QVector<int> related(int id, int maxHops) const;
+
+    // Turns the related() cache off and drops it, for copies that are read
+    // from several threads at once.
+    void disableCache() { m_cacheRelated = false; m_relatedCache.clear(); }
+
+private:
+    struct Source {
+        int id;
+        int link; // position in m_links[id]
+    };
+
+    QVector<int> neighbours(int id) const;
+    QString key(int id) const;
+    int linkCount(int id) const;
+    Edge edge(int id, int link) const; // link `link` of entry `id`
+    QVector<Source> sources(const QString &foldedWord) const;
+    static qint64 linkKey(int id, int link) { return (qint64(id) << 32) | quint32(link); }
+
+    QVector<QString> m_keys;                   // folded word, by id - m_baseCount
+    QVector<QVector<Edge>> m_links;            // by id - m_baseCount
+    QHash<QString, QVector<Source>> m_reverse; // folded listed word -> sources
+    mutable QHash<qint64, QVector<int>> m_relatedCache; // (id, hops) -> related ids
+    bool m_cacheRelated = true;
+
+    // Stored graph of the snapshot ids [0, m_baseCount).
+    const quint32 *m_baseLinkStart = nullptr; // first edge of each id, count + 1
+    const Edge *m_baseEdges = nullptr;
+    const qint32 *m_baseKeys = nullptr;       // position of each id's word in m_baseReverse, or -1
+    MappedTable<Source> m_baseReverse;        // folded listed word -> sources, plus every stored word
+    int m_baseCount = 0;
+    QHash<qint64, int> m_resolved; // linkKey() of a stored unresolved link -> added id
+};
+
+#endif // RELATION_INDEX_H
@@ -0,0 +1,762 @@
+#ifndef SEED_WORDS_H
+#define SEED_WORDS_H
+
+#include <QString>
+#include <QStringView>
+#include "Word_Files/Word_Storage.h"
+
+// Built-in dictionary entries, stored as a constant table of UTF-16 literals.
+// Entries are only turned into WordEntry objects when they are actually
+// needed, and the QStrings they produce point straight at this static data
+// instead of copying it.
+//
+// Definitions, usages and backgrounds are stored in their final form (a
+// usage identical to the definition is already rewritten as an
+// "In context, ..." example), so no post-processing runs at load time.
+struct SeedWord {
+    QStringView word;
+    QStringView definition;
+    QStringView synonyms[3];
+    QStringView antonyms[3];
+    QStringView background;
+    QStringView usage;
+    QStringView translation;
+};
+
+// Wraps static UTF-16 data in a QString without copying it.
+inline QString seedString(QStringView s)
+{
+    return QString::fromRawData(reinterpret_cast<const QChar *>(s.utf16()), s.size());
+}
+
+inline QStringList seedList(const QStringView (&items)[3])
+{
+    QStringList out;
+    for (QStringView s : items) {
+        if (!s.isEmpty()) out.append(seedString(s));
+    }
+    return out;
+}
+
+inline WordEntry seedEntry(const SeedWord &s)
+{
+    WordEntry e;
+    e.word = seedString(s.word);
+    e.definition = seedString(s.definition);
+    e.synonyms = seedList(s.synonyms);
+    e.antonyms = seedList(s.antonyms);
+    e.background = seedString(s.background);
+    e.usage = seedString(s.usage);
+    e.translation = seedString(s.translation);
+    return e;
+}
+
+static constexpr SeedWord SEED_WORDS[] = {
+    // Letter A Words
+    { u"Abandon",
+      u"He had to abandon his plans when the storm hit.",
+      { u"desert", u"forsake", u"relinquish" },
+      { u"retain", u"keep", u"embrace" },
+      u"Origin: Old French 'abandoner', to surrender",
+      u"In context, 'Abandon' can be used like this: He had to abandon his plans when the storm hit.",
+      u"Iwan\nKasingkahulugan: talikuran, pabayaan, isuko\nKasalungat: panatilihin, ingatan, yakapin\nHalimbawa: Kinailangan niyang iwan ang kanyang mga plano nang dumating ang bagyo." },
+    { u"Abolish",
+      u"The law was abolished after it was deemed unjust.",
+      { u"eradicate", u"eliminate", u"cancel" },
+      { u"establish", u"create", u"uphold" },
+      u"Origin: Latin 'abolere', to destroy",
+      u"In context, 'Abolish' can be used like this: The law was abolished after it was deemed unjust.",
+      u"Alisin (Pawiin)\nKasingkahulugan: burahin, alisin, kanselahin\nKasalungat: itatag, likhain, panatilihin\nHalimbawa: Inalis ang batas matapos itong ideklarang hindi makatarungan." },
+    { u"Absorb",
+      u"The sponge will absorb all the water from the spill.",
+      { u"soak up", u"take in", u"assimilate" },
+      { u"expel", u"release", u"discharge" },
+      u"Origin: Latin 'absorbere', to swallow up",
+      u"In context, 'Absorb' can be used like this: The sponge will absorb all the water from the spill.",
+      u"Sumipsip\nKasingkahulugan: sumipsip, tanggapin, lamunin\nKasalungat: ilabas, pakawalan, palabasin\nHalimbawa: Sisisipsipin ng espongha ang lahat ng tubig sa natapon." },
+    { u"Abundant",
+      u"The region is abundant in natural resources.",
+      { u"plentiful", u"ample", u"copious" },
+      { u"scarce", u"limited", u"inadequate" },
+      u"Origin: Latin 'abundare', to overflow",
+      u"In context, 'Abundant' can be used like this: The region is abundant in natural resources.",
+      u"Masagana\nKasingkahulugan: marami, sagana, labis\nKasalungat: kulang, limitado, kapos\nHalimbawa: Sagana ang rehiyon sa likas na yaman." },
+    { u"Accelerate",
+      u"The car started to accelerate as we drove downhill.",
+      { u"speed up", u"hasten", u"quicken" },
+      { u"slow down", u"decelerate", u"delay" },
+      u"Origin: Latin 'accelerare', to hasten",
+      u"In context, 'Accelerate' can be used like this: The car started to accelerate as we drove downhill.",
+      u"Pabilisin\nKasingkahulugan: pabilisin, paharapin, magmadali\nKasalungat: pabagalin, huminto, ipagpaliban\nHalimbawa: Nagsimulang pabilisin ng kotse ang takbo pababa ng burol." },
+    { u"Accessible",
+      u"The library is accessible to everyone, including people with disabilities.",
+      { u"reachable", u"attainable", u"available" },
+      { u"inaccessible", u"unreachable", u"blocked" },
+      u"Origin: Latin 'accessibilis', easy to reach",
+      u"In context, 'Accessible' can be used like this: The library is accessible to everyone, including people with disabilities.",
+      u"Madaling Mapuntahan\nKasingkahulugan: maabot, makuha, magamit\nKasalungat: hindi maabot, sarado, harang\nHalimbawa: Madaling mapuntahan ng lahat ang aklatan, kabilang ang may kapansanan." },
+    { u"Accomplish",
+      u"She managed to accomplish all her goals for the year.",
+      { u"achieve", u"complete", u"fulfill" },
+      { u"fail", u"miss", u"neglect" },
+      u"Origin: Middle English 'accomplisshen', to achieve",
+      u"In context, 'Accomplish' can be used like this: She managed to accomplish all her goals for the year.",
+      u"Matupad\nKasingkahulugan: makamit, matapos, maganap\nKasalungat: mabigo, mapalampas, pabayaan\nHalimbawa: Nagawa niyang matupad ang lahat ng kanyang mga layunin sa taon." },
+    { u"Accurate",
+      u"The test results were accurate and showed no errors.",
+      { u"correct", u"precise", u"exact" },
+      { u"inaccurate", u"incorrect", u"imprecise" },
+      u"Origin: Latin 'accuratus', well done",
+      u"In context, 'Accurate' can be used like this: The test results were accurate and showed no errors.",
+      u"Tumpak\nKasingkahulugan: tama, eksakto, wasto\nKasalungat: mali, hindi tama, malabo\nHalimbawa: Tumpak ang mga resulta ng pagsusuri at walang mali." },
+
+    // Letter B Words
+    { u"Balance",
+      u"She struggled to find a balance between work and personal life.",
+      { u"equilibrium", u"stability", u"symmetry" },
+      { u"imbalance", u"instability", u"disproportion" },
+      u"Origin: Latin 'bilanx', having two pans",
+      u"In context, 'Balance' can be used like this: She struggled to find a balance between work and personal life.",
+      u"Balanse\nKasingkahulugan: pagkakapantay, katatagan, simetriya\nKasalungat: kawalan ng balanse, kawalang-tatag, hindi pagkakatugma\nHalimbawa: Nahirapan siyang hanapin ang balanse sa pagitan ng trabaho at personal na buhay." },
+    { u"Banish",
+      u"The king decided to banish the traitor from the kingdom.",
+      { u"exile", u"expel", u"eject" },
+      { u"welcome", u"invite", u"admit" },
+      u"Origin: Old French 'banir', to proclaim",
+      u"In context, 'Banish' can be used like this: The king decided to banish the traitor from the kingdom.",
+      u"Itaboy\nKasingkahulugan: ipatapon, paalisin, palayasin\nKasalungat: tanggapin, anyayahan, papasukin\nHalimbawa: Nagpasya ang hari na itaboy ang taksil mula sa kaharian." },
+    { u"Bare",
+      u"The bare walls of the room made it feel cold and empty.",
+      { u"exposed", u"uncovered", u"nude" },
+      { u"clothed", u"covered", u"protected" },
+      u"Origin: Old English 'baer', naked",
+      u"In context, 'Bare' can be used like this: The bare walls of the room made it feel cold and empty.",
+      u"Hubad\nKasingkahulugan: walang takip, lantad, hubo\nKasalungat: may damit, natatakpan, protektado\nHalimbawa: Ang hubad na mga pader ng silid ay nagbigay dito ng malamig na pakiramdam." },
+    { u"Benevolent",
+      u"The benevolent king always helped the poor.",
+      { u"kind", u"charitable", u"compassionate" },
+      { u"malevolent", u"unkind", u"cruel" },
+      u"Origin: Latin 'benevolus', wishing well",
+      u"In context, 'Benevolent' can be used like this: The benevolent king always helped the poor.",
+      u"Mapagkawanggawa\nKasingkahulugan: mabait, maawain, matulungin\nKasalungat: malupit, masama, walang puso\nHalimbawa: Ang mapagkawanggawang hari ay laging tumutulong sa mahihirap." },
+    { u"Brave",
+      u"The brave firefighter ran into the burning building to rescue the family.",
+      { u"courageous", u"fearless", u"valiant" },
+      { u"cowardly", u"timid", u"fearful" },
+      u"Origin: Italian 'bravo', wild or fierce",
+      u"In context, 'Brave' can be used like this: The brave firefighter ran into the burning building to rescue the family.",
+      u"Matapang\nKasingkahulugan: walang takot, magiting, matibay ang loob\nKasalungat: duwag, mahina ang loob, natatakot\nHalimbawa: Ang matapang na bumbero ay pumasok sa nasusunog na gusali upang iligtas ang pamilya." },
+    { u"Bland",
+      u"The soup was too bland for my taste; it needed more seasoning.",
+      { u"dull", u"tasteless", u"insipid" },
+      { u"flavorful", u"spicy", u"exciting" },
+      u"Origin: Latin 'blandus', smooth or flattering",
+      u"In context, 'Bland' can be used like this: The soup was too bland for my taste; it needed more seasoning.",
+      u"Maputla\nKasingkahulugan: matabang, walang lasa, walang sigla\nKasalungat: malasa, maanghang, masigla\nHalimbawa: Masyadong maputla ang sabaw para sa panlasa ko; kailangan pa ng pampalasa." },
+    { u"Blissful",
+      u"They spent a blissful weekend in the mountains.",
+      { u"happy", u"content", u"joyful" },
+      { u"miserable", u"unhappy", u"sorrowful" },
+      u"Origin: Old English 'blisse', joy",
+      u"In context, 'Blissful' can be used like this: They spent a blissful weekend in the mountains.",
+      u"Masaya\nKasingkahulugan: maligaya, kuntento, masigla\nKasalungat: malungkot, balisa, nagdadalamhati\nHalimbawa: Nagtamasa sila ng masayang weekend sa kabundukan." },
+    { u"Blunt",
+      u"Her blunt response to the criticism surprised everyone in the room.",
+      { u"direct", u"straightforward", u"frank" },
+      { u"tactful", u"diplomatic", u"subtle" },
+      u"Origin: Scandinavian 'blunt', dull or blunt edge",
+      u"In context, 'Blunt' can be used like this: Her blunt response to the criticism surprised everyone in the room.",
+      u"Diretso\nKasingkahulugan: prangka, tapat, walang paligoy\nKasalungat: maingat, diplomatikong, maselan\nHalimbawa: Ang prangka niyang sagot sa puna ay ikinagulat ng lahat sa silid." },
+    { u"Bore",
+      u"The meeting lasted for hours and really started to bore me.",
+      { u"tire", u"weary", u"dull" },
+      { u"entertain", u"amuse", u"interest" },
+      u"Origin: Old French 'borer', to drill",
+      u"In context, 'Bore' can be used like this: The meeting lasted for hours and really started to bore me.",
+      u"Nakakainip\nKasingkahulugan: nakakapagod, nakakaantok, walang sigla\nKasalungat: nakakaaliw, nakakatawa, interesante\nHalimbawa: Napakatagal ng pulong at talagang nakakainip." },
+    { u"Brisk",
+      u"She took a brisk walk in the park to get some fresh air.",
+      { u"energetic", u"quick", u"lively" },
+      { u"sluggish", u"slow", u"lethargic" },
+      u"Origin: Scandinavian, meaning sharp or biting",
+      u"In context, 'Brisk' can be used like this: She took a brisk walk in the park to get some fresh air.",
+      u"Masigla\nKasingkahulugan: maliksi, mabilis, buhay na buhay\nKasalungat: mabagal, matamlay, tamad\nHalimbawa: Naglakad siya nang masigla sa parke para makalanghap ng sariwang hangin." },
+    { u"Bitter",
+      u"The bitter argument left both of them upset and frustrated.",
+      { u"harsh", u"sour", u"resentful" },
+      { u"sweet", u"pleasant", u"mild" },
+      u"Origin: Old English 'biter', to bite",
+      u"In context, 'Bitter' can be used like this: The bitter argument left both of them upset and frustrated.",
+      u"Mapait\nKasingkahulugan: marahas, masakit, may hinanakit\nKasalungat: matamis, magaan, maganda\nHalimbawa: Ang mapait na pagtatalo ay nagdulot ng sama ng loob sa magkabilang panig." },
+    { u"Bigotry",
+      u"Bigotry has no place in a society that values equality.",
+      { u"intolerance", u"prejudice", u"discrimination" },
+      { u"open-mindedness", u"acceptance", u"fairness" },
+      u"Origin: French 'bigoterie', derived from Bigos",
+      u"In context, 'Bigotry' can be used like this: Bigotry has no place in a society that values equality.",
+      u"Pagkapanatiko\nKasingkahulugan: pagkiling, pagtatangi, diskriminasyon\nKasalungat: pagiging bukas, pagtanggap, katarungan\nHalimbawa: Walang lugar ang pagkapanatiko sa lipunang nagmamahal sa pagkakapantay-pantay." },
+    { u"Baffled",
+      u"She was baffled by the strange behavior of her friend.",
+      { u"confused", u"puzzled", u"bewildered" },
+      { u"certain", u"clear", u"sure" },
+      u"Origin: Scottish, meaning to check or repel",
+      u"In context, 'Baffled' can be used like this: She was baffled by the strange behavior of her friend.",
+      u"Nalito\nKasingkahulugan: naguluhan, nagtataka, nagtaka\nKasalungat: tiyak, malinaw, sigurado\nHalimbawa: Nalito siya sa kakaibang asal ng kanyang kaibigan." },
+    { u"Benevolence",
+      u"His acts of benevolence made him beloved by all.",
+      { u"kindness", u"goodwill", u"generosity" },
+      { u"selfishness", u"cruelty", u"malevolence" },
+      u"Origin: Latin 'benevolentia', desire to do good",
+      u"In context, 'Benevolence' can be used like this: His acts of benevolence made him beloved by all.",
+      u"Kabaitan\nKasingkahulugan: kagandahang-loob, kabutihan, pagkamaawain\nKasalungat: kalupitan, kasamaan, pagiging makasarili\nHalimbawa: Ang kanyang kabaitan ay minahal ng lahat." },
+    { u"Brittle",
+      u"The glass vase was brittle and broke into pieces with the slightest touch.",
+      { u"fragile", u"delicate", u"weak" },
+      { u"durable", u"strong", u"resilient" },
+      u"Origin: Old English 'breotan', to break",
+      u"In context, 'Brittle' can be used like this: The glass vase was brittle and broke into pieces with the slightest touch.",
+      u"Marupok\nKasingkahulugan: madaling mabasag, mahina, maramdamin\nKasalungat: matibay, matatag, matigas\nHalimbawa: Ang basong iyon ay marupok at agad nabasag nang mahulog." },
+    { u"Brilliant",
+      u"The scientist's brilliant discovery changed the field forever.",
+      { u"outstanding", u"exceptional", u"talented" },
+      { u"dull", u"mediocre", u"uninspired" },
+      u"Origin: Italian 'brillare', to shine",
+      u"In context, 'Brilliant' can be used like this: The scientist's brilliant discovery changed the field forever.",
+      u"Matalino\nKasingkahulugan: magaling, mahusay, henyo\nKasalungat: bobo, mahina, walang alam\nHalimbawa: Ang matalinong tuklas ng siyentipiko ay nagbago ng larangan magpakailanman." },
+    { u"Bounty",
+      u"The harvest provided a bounty of fruits and vegetables.",
+      { u"abundance", u"plenty", u"wealth" },
+      { u"scarcity", u"shortage", u"lack" },
+      u"Origin: Old French 'bonte', goodness",
+      u"In context, 'Bounty' can be used like this: The harvest provided a bounty of fruits and vegetables.",
+      u"Kasaganaan\nKasingkahulugan: kayamanan, kasapatan, kasiyahan\nKasalungat: kakulangan, kakapusan, paghihirap\nHalimbawa: Ang aning ito ay nagdala ng kasaganaan ng prutas at gulay." },
+    { u"Blaze",
+      u"The blaze of the campfire kept us warm on the cold night.",
+      { u"fire", u"flame", u"inferno" },
+      { u"extinguish", u"douse", u"put out" },
+      u"Origin: Old English 'bl\u00e6se', white mark",
+      u"In context, 'Blaze' can be used like this: The blaze of the campfire kept us warm on the cold night.",
+      u"Apoy\nKasingkahulugan: siga, liyab, alab\nKasalungat: puksain, patayin, apulahin\nHalimbawa: Ang apoy ng bonfire ang nagbigay-init sa malamig na gabi." },
+    { u"Baffle",
+      u"The magician's trick completely baffled the audience.",
+      { u"confuse", u"perplex", u"bewilder" },
+      { u"clarify", u"explain", u"simplify" },
+      u"Origin: Scottish, to check or repel",
+      u"In context, 'Baffle' can be used like this: The magician's trick completely baffled the audience.",
+      u"Malito\nKasingkahulugan: maguluhan, malabuan, mabigla\nKasalungat: malinawan, maunawaan, masimplihan\nHalimbawa: Lubos na nalito ang mga tao sa mahikang ipinakita ng salamangkero." },
+    { u"Brawl",
+      u"The two men got into a brawl outside the bar.",
+      { u"fight", u"clash", u"scuffle" },
+      { u"peace", u"harmony", u"calm" },
+      u"Origin: Middle Dutch 'bralle', to brawl",
+      u"In context, 'Brawl' can be used like this: The two men got into a brawl outside the bar.",
+      u"Gulo\nKasingkahulugan: suntukan, sagupaan, alitan\nKasalungat: kapayapaan, pagkakaisa, katahimikan\nHalimbawa: Nagkaroon ng gulo sa labas ng bar dahil sa dalawang lalaki." },
+    { u"Bright",
+      u"The future looks bright for young professionals in this field.",
+      { u"radiant", u"brilliant", u"shining" },
+      { u"dull", u"dim", u"dark" },
+      u"Origin: Old English 'beorht', shining",
+      u"In context, 'Bright' can be used like this: The future looks bright for young professionals in this field.",
+      u"Maliwanag\nKasingkahulugan: maningning, makintab, kumikislap\nKasalungat: madilim, mapusyaw, walang ilaw\nHalimbawa: Maliwanag ang kinabukasan ng mga kabataang propesyonal sa larangang ito." },
+    { u"Blunder",
+      u"He made a huge blunder during the presentation by forgetting his key points.",
+      { u"mistake", u"error", u"misstep" },
+      { u"success", u"achievement", u"triumph" },
+      u"Origin: Scandinavian 'blunda', to doze",
+      u"In context, 'Blunder' can be used like this: He made a huge blunder during the presentation by forgetting his key points.",
+      u"Pagkakamali\nKasingkahulugan: error, pagkukulang, pagkadulas\nKasalungat: tagumpay, tama, katuparan\nHalimbawa: Nagkaroon siya ng malaking pagkakamali sa presentasyon nang makalimutan ang mahahalagang punto." },
+    { u"Bizarre",
+      u"His bizarre behavior left everyone in the office confused.",
+      { u"strange", u"odd", u"peculiar" },
+      { u"normal", u"conventional", u"typical" },
+      u"Origin: Spanish 'bizarro', brave or fierce",
+      u"In context, 'Bizarre' can be used like this: His bizarre behavior left everyone in the office confused.",
+      u"Kakaiba\nKasingkahulugan: pambihira, hindi karaniwan, nakapagtataka\nKasalungat: normal, karaniwan, pangkaraniwan\nHalimbawa: Ang kakaibang kilos niya ay nakagulat sa lahat sa opisina." },
+    { u"Breezy",
+      u"The breezy afternoon made the beach a perfect spot to relax.",
+      { u"windy", u"fresh", u"airy" },
+      { u"calm", u"still", u"quiet" },
+      u"Origin: English 'breeze', light wind",
+      u"In context, 'Breezy' can be used like this: The breezy afternoon made the beach a perfect spot to relax.",
+      u"Mahangin\nKasingkahulugan: presko, maaliwalas, may simoy\nKasalungat: kalmado, walang hangin, tahimik\nHalimbawa: Ang mahangin na hapon ay perpekto para magpahinga sa tabing-dagat." },
+    { u"Bumpy",
+      u"The road was bumpy, making the ride uncomfortable.",
+      { u"uneven", u"rough", u"rugged" },
+      { u"smooth", u"level", u"even" },
+      u"Origin: English 'bump', a raised mass",
+      u"In context, 'Bumpy' can be used like this: The road was bumpy, making the ride uncomfortable.",
+      u"Lubak-lubak\nKasingkahulugan: hindi pantay, magaspang, mabundok\nKasalungat: makinis, pantay, maayos\nHalimbawa: Lubak-lubak ang kalsada kaya hindi komportable ang biyahe." },
+    { u"Boost",
+      u"The new advertising campaign helped boost sales.",
+      { u"increase", u"raise", u"enhance" },
+      { u"decrease", u"diminish", u"reduce" },
+      u"Origin: English 'boost', to push up",
+      u"In context, 'Boost' can be used like this: The new advertising campaign helped boost sales.",
+      u"Palakasin\nKasingkahulugan: dagdagan, paunlarin, pataasin\nKasalungat: bawasan, pahinain, pababain\nHalimbawa: Ang bagong kampanya sa marketing ay nakatulong para palakasin ang benta." },
+    { u"Bold",
+      u"His bold decision to start a new business paid off in the end.",
+      { u"daring", u"courageous", u"fearless" },
+      { u"timid", u"cautious", u"afraid" },
+      u"Origin: Old English 'bald', confident",
+      u"In context, 'Bold' can be used like this: His bold decision to start a new business paid off in the end.",
+      u"Matapang\nKasingkahulugan: walang takot, palaban, mapangahas\nKasalungat: mahina, duwag, matatakutin\nHalimbawa: Ang matapang niyang desisyon na magsimula ng negosyo ay nagbunga ng tagumpay." },
+    { u"Bashful",
+      u"The bashful child hid behind his mother when meeting strangers.",
+      { u"shy", u"timid", u"self-conscious" },
+      { u"outgoing", u"confident", u"bold" },
+      u"Origin: English 'bash', to strike",
+      u"In context, 'Bashful' can be used like this: The bashful child hid behind his mother when meeting strangers.",
+      u"Mahiyain\nKasingkahulugan: mailap, tahimik, mahina ang loob\nKasalungat: palakaibigan, kumpiyansa, matapang\nHalimbawa: Ang mahiyain na bata ay nagtago sa likod ng kanyang ina nang makilala ang bagong tao." },
+    { u"Beaming",
+      u"She walked into the room with a beaming smile on her face.",
+      { u"radiant", u"glowing", u"cheerful" },
+      { u"gloomy", u"sad", u"downcast" },
+      u"Origin: English 'beam', a ray of light",
+      u"In context, 'Beaming' can be used like this: She walked into the room with a beaming smile on her face.",
+      u"Nakangiti\nKasingkahulugan: masigla, maliwanag, masaya\nKasalungat: malungkot, matamlay, seryoso\nHalimbawa: Pumasok siya sa silid na may nakangiting mukha." },
+    { u"Bountiful",
+      u"The garden produced a bountiful harvest this year.",
+      { u"plentiful", u"abundant", u"generous" },
+      { u"scarce", u"insufficient", u"limited" },
+      u"Origin: Old French 'bonte', goodness",
+      u"In context, 'Bountiful' can be used like this: The garden produced a bountiful harvest this year.",
+      u"Masagana\nKasingkahulugan: marami, sagana, mapagbigay\nKasalungat: kulang, kakaunti, limitado\nHalimbawa: Ang hardin ay nagbunga ng masaganang ani ngayong taon." },
+    { u"Brutal",
+      u"The brutal truth was hard to hear but necessary.",
+      { u"savage", u"cruel", u"harsh" },
+      { u"gentle", u"kind", u"compassionate" },
+      u"Origin: Latin 'brutus', dull or stupid",
+      u"In context, 'Brutal' can be used like this: The brutal truth was hard to hear but necessary.",
+      u"Malupit\nKasingkahulugan: marahas, walang awa, brutal\nKasalungat: mabait, maawain, banayad\nHalimbawa: Mahirap tanggapin ang malupit na katotohanan, ngunit ito ay kailangan." },
+    { u"Befriend",
+      u"He tried to befriend the new student by offering help with her homework.",
+      { u"ally", u"support", u"assist" },
+      { u"antagonize", u"reject", u"oppose" },
+      u"Origin: English 'friend', a person one knows well",
+      u"In context, 'Befriend' can be used like this: He tried to befriend the new student by offering help with her homework.",
+      u"Makipagkaibigan\nKasingkahulugan: tumulong, sumuporta, makisama\nKasalungat: lumaban, tumanggi, kontrahin\nHalimbawa: Sinubukan niyang makipagkaibigan sa bagong estudyante sa pamamagitan ng pagtulong sa takdang-aralin." },
+    { u"Bliss",
+      u"They lived in bliss for many years after their wedding.",
+      { u"happiness", u"joy", u"contentment" },
+      { u"misery", u"sorrow", u"sadness" },
+      u"Origin: Old English 'blisse', joy",
+      u"In context, 'Bliss' can be used like this: They lived in bliss for many years after their wedding.",
+      u"Kaligayahan\nKasingkahulugan: saya, tuwa, kasiyahan\nKasalungat: kalungkutan, dalamhati, pighati\nHalimbawa: Nabuhay sila sa kaligayahan matapos ang kanilang kasal." },
+    { u"Bash",
+      u"He gave the door a bash with the hammer, trying to fix it.",
+      { u"strike", u"hit", u"slam" },
+      { u"tap", u"poke", u"nudge" },
+      u"Origin: Scandinavian 'base', a blow",
+      u"In context, 'Bash' can be used like this: He gave the door a bash with the hammer, trying to fix it.",
+      u"Hampas\nKasingkahulugan: suntok, palo, bugbog\nKasalungat: tapik, tulak, dampi\nHalimbawa: Hinampas niya ang pinto gamit ang martilyo upang ayusin ito." },
+    { u"Ban",
+      u"The school decided to ban cell phones during class.",
+      { u"prohibit", u"forbid", u"outlaw" },
+      { u"allow", u"permit", u"authorize" },
+      u"Origin: Old Norse 'banna', to forbid",
+      u"In context, 'Ban' can be used like this: The school decided to ban cell phones during class.",
+      u"Ipinagbawal\nKasingkahulugan: ipagbawal, ipatigil, ipahinto\nKasalungat: payagan, pahintulutan, pahintulot\nHalimbawa: Nagpasya ang paaralan na ipagbawal ang paggamit ng cellphone sa klase." },
+    { u"Befuddle",
+      u"The complicated instructions befuddled the new employees.",
+      { u"confuse", u"perplex", u"bewilder" },
+      { u"clarify", u"explain", u"simplify" },
+      u"Origin: English 'befuddle', to confuse utterly",
+      u"In context, 'Befuddle' can be used like this: The complicated instructions befuddled the new employees.",
+      u"Lituhin\nKasingkahulugan: guluhin, lituhin, gulantangin\nKasalungat: ipaliwanag, linawin, payapain\nHalimbawa: Nalito ang mga bagong empleyado sa komplikadong tagubilin." },
+    { u"Bristle",
+      u"His anger made his hair bristle with frustration.",
+      { u"stiffen", u"stand up", u"flare" },
+      { u"relax", u"soften", u"calm" },
+      u"Origin: Old English 'byrst', to burst",
+      u"In context, 'Bristle' can be used like this: His anger made his hair bristle with frustration.",
+      u"Tindig-Balahibo\nKasingkahulugan: tumayo, manigas, magalit\nKasalungat: mag-relax, lumambot, kukalma\nHalimbawa: Tumindig ang kanyang balahibo sa galit." },
+    { u"Banishment",
+      u"The punishment for breaking the rules was banishment.",
+      { u"exile", u"expulsion", u"deportation" },
+      { u"admission", u"welcome", u"acceptance" },
+      u"Origin: Old French 'banir', to proclaim",
+      u"In context, 'Banishment' can be used like this: The punishment for breaking the rules was banishment.",
+      u"Pagkatapon\nKasingkahulugan: pagpapatalsik, pagpapaalis, deportasyon\nKasalungat: pagbabalik, pagtanggap, pagbabalik-tanaw\nHalimbawa: Ang parusa sa krimen ay pagkatapon sa komunidad." },
+    { u"Bait",
+      u"The fisherman used worms as bait to catch the fish.",
+      { u"lure", u"entice", u"attract" },
+      { u"discourage", u"repel", u"deter" },
+      u"Origin: Old Norse 'beita', to feed",
+      u"In context, 'Bait' can be used like this: The fisherman used worms as bait to catch the fish.",
+      u"Pang-akit\nKasingkahulugan: pain, tukso, panghila\nKasalungat: panglayo, pangtaboy, pang-iwas\nHalimbawa: Gumamit ang mangingisda ng bulate bilang pain sa pangingisda." },
+    { u"Braggart",
+      u"He's such a braggart that no one likes to talk to him.",
+      { u"boaster", u"show-off", u"egotist" },
+      { u"humble", u"modest", u"reserved" },
+      u"Origin: Old French 'braguete', boasting",
+      u"In context, 'Braggart' can be used like this: He's such a braggart that no one likes to talk to him.",
+      u"Mayabang\nKasingkahulugan: palalo, mapagmataas, nagyayabang\nKasalungat: mapagkumbaba, mahinhin, maamo\nHalimbawa: Napakayabang niya kaya walang gustong makipag-usap sa kanya." },
+    { u"Befit",
+      u"The luxury hotel was a perfect place to befit her status.",
+      { u"suit", u"be appropriate", u"fit" },
+      { u"misfit", u"clash", u"mismatch" },
+      u"Origin: Old English 'befittan', to make suitable",
+      u"In context, 'Befit' can be used like this: The luxury hotel was a perfect place to befit her status.",
+      u"Bagay\nKasingkahulugan: akma, nararapat, tugma\nKasalungat: hindi tugma, salungat, taliwas\nHalimbawa: Ang marangyang hotel ay bagay sa kanyang katayuan." },
+    { u"Breach",
+      u"The company was sued for a breach of contract.",
+      { u"violation", u"infraction", u"break" },
+      { u"compliance", u"observance", u"respect" },
+      u"Origin: Old French 'breche', a break",
+      u"In context, 'Breach' can be used like this: The company was sued for a breach of contract.",
+      u"Paglabag\nKasingkahulugan: pagkakasala, pagsuway, paglabag\nKasalungat: pagsunod, pagtalima, paggalang\nHalimbawa: Dinimanda ang kompanya dahil sa paglabag sa kontrata." },
+    { u"Bellow",
+      u"He began to bellow in frustration when he couldn't find the keys.",
+      { u"shout", u"yell", u"roar" },
+      { u"whisper", u"murmur", u"mutter" },
+      u"Origin: Old English 'belgan', to swell",
+      u"In context, 'Bellow' can be used like this: He began to bellow in frustration when he couldn't find the keys.",
+      u"Sigaw\nKasingkahulugan: hiyaw, bulalas, alulong\nKasalungat: bulong, ungol, pabulong\nHalimbawa: Napasigaw siya sa galit nang hindi makita ang kanyang susi." },
+    { u"Betray",
+      u"He felt heartbroken after his best friend betrayed him.",
+      { u"deceive", u"backstab", u"mislead" },
+      { u"support", u"stand by", u"be loyal" },
+      u"Origin: Old French 'betrayer', to deliver up",
+      u"In context, 'Betray' can be used like this: He felt heartbroken after his best friend betrayed him.",
+      u"Ipagkanulo\nKasingkahulugan: linlangin, traydurin, lokohin\nKasalungat: tulungan, ipagtanggol, maging tapat\nHalimbawa: Labis ang kanyang sama ng loob nang siya'y ipagkanulo ng matalik na kaibigan." },
+    { u"Baggage",
+      u"She packed all her baggage before heading to the airport.",
+      { u"luggage", u"suitcases", u"possessions" },
+      {},
+      u"Origin: Old French 'bagage', what is carried",
+      u"In context, 'Baggage' can be used like this: She packed all her baggage before heading to the airport.",
+      u"Bagahe\nKasingkahulugan: maleta, gamit, dalahin\nKasalungat: wala (depende sa gamit)\nHalimbawa: Ipinakete niya ang lahat ng kanyang bagahe bago pumunta sa paliparan." },
+    { u"Bully",
+      u"He became the target of a bully at school who took his lunch money.",
+      { u"intimidate", u"harass", u"persecute" },
+      { u"protect", u"defend", u"support" },
+      u"Origin: Dutch 'boel', lover or brother",
+      u"In context, 'Bully' can be used like this: He became the target of a bully at school who took his lunch money.",
+      u"Mang-api\nKasingkahulugan: manakot, mang-asar, manggulpi\nKasalungat: ipagtanggol, protektahan, tulungan\nHalimbawa: Naging biktima siya ng mang-aapi na kumukuha ng kanyang baon sa paaralan." },
+
+    // -----------------------------------------------------------------
+    { u"Courageous",
+      u"The courageous soldier saved his comrades under heavy fire.",
+      { u"brave", u"valiant", u"fearless" },
+      { u"cowardly", u"fearful", u"timid" },
+      u"Origin: Latin 'coraticus' (via Old French), relating to bravery",
+      u"In context, 'Courageous' can be used like this: The courageous soldier saved his comrades under heavy fire.",
+      u"Matapang\nKasingkahulugan: matapang, magiting, walang takot\nKasalungat: duwag, takot, mahiyain\nHalimbawa: Ang matapang na sundalo ay iniligtas ang kanyang mga kasama sa gitna ng putukan." },
+    { u"Clever",
+      u"His clever solution to the problem impressed everyone.",
+      { u"smart", u"witty", u"intelligent" },
+      { u"dumb", u"foolish", u"naive" },
+      u"Origin: Old English 'cl\u01e3fre', quick to understand",
+      u"In context, 'Clever' can be used like this: His clever solution to the problem impressed everyone.",
+      u"Matalino\nKasingkahulugan: matalino, madiskarte, marunong\nKasalungat: mangmang, hangal, inosente\nHalimbawa: Ang matalinong solusyon niya sa problema ay ikinamangha ng lahat." },
+    { u"Clumsy",
+      u"She felt clumsy as she tripped over the chair.",
+      { u"awkward", u"uncoordinated", u"graceless" },
+      { u"graceful", u"coordinated", u"agile" },
+      u"Origin: uncertain, related to lacking coordination",
+      u"In context, 'Clumsy' can be used like this: She felt clumsy as she tripped over the chair.",
+      u"Tulad ng walang kilos\nKasingkahulugan: awkward, uncoordinated, graceless\nKasalungat: graceful, coordinated, agile\nHalimbawa: Nahulog siya sa upuan dahil sa pagiging clumsy niya." },
+    { u"Cautious",
+      u"The cautious driver slowed down when the weather became foggy.",
+      { u"careful", u"prudent", u"wary" },
+      { u"reckless", u"careless", u"hasty" },
+      u"Origin: Latin 'cautus', careful",
+      u"In context, 'Cautious' can be used like this: The cautious driver slowed down when the weather became foggy.",
+      u"Maingat\nKasingkahulugan: maingat, mapanuri, mapagmatyag\nKasalungat: pabaya, padalos-dalos, walang ingat\nHalimbawa: Ang maingat na drayber ay bumagal nang maging mahamog ang daan." },
+    { u"Charming",
+      u"He was a charming host who made everyone feel welcome.",
+      { u"delightful", u"enchanting", u"charismatic" },
+      { u"unappealing", u"unattractive", u"rude" },
+      u"Origin: Old French 'charmant', to enchant",
+      u"In context, 'Charming' can be used like this: He was a charming host who made everyone feel welcome.",
+      u"Kaakit-akit\nKasingkahulugan: nakakaaliw, kahali-halina, may karisma\nKasalungat: hindi kaaya-aya, bastos, walang dating\nHalimbawa: Siya ay isang kaakit-akit na host na nagparamdam ng ginhawa sa lahat." },
+    { u"Curious",
+      u"The child was curious about the world around him and asked a lot of questions.",
+      { u"inquisitive", u"interested", u"eager to learn" },
+      { u"indifferent", u"uninterested", u"apathetic" },
+      u"Origin: Latin 'curiosus', inquisitive",
+      u"In context, 'Curious' can be used like this: The child was curious about the world around him and asked a lot of questions.",
+      u"Palaisip\nKasingkahulugan: mausisa, interesado, sabik matuto\nKasalungat: walang pakialam, hindi interesado, malamig\nHalimbawa: Ang bata ay palaisip tungkol sa mundo at madalas magtanong." },
+    { u"Chilly",
+      u"It was a chilly morning, so I grabbed my jacket before heading out.",
+      { u"cold", u"cool", u"brisk" },
+      { u"warm", u"hot", u"toasty" },
+      u"Origin: Old English 'ciele', chilly",
+      u"In context, 'Chilly' can be used like this: It was a chilly morning, so I grabbed my jacket before heading out.",
+      u"Malamig\nKasingkahulugan: malamig, presko, maginaw\nKasalungat: mainit, maalinsangan, maalab\nHalimbawa: Maginaw ang umaga kaya nagsuot ako ng jacket bago umalis." },
+    { u"Courage",
+      u"It took a lot of courage to speak in front of such a large crowd.",
+      { u"bravery", u"fortitude", u"valor" },
+      { u"fear", u"cowardice", u"timidity" },
+      u"Origin: Latin 'coraticus' via Old French",
+      u"In context, 'Courage' can be used like this: It took a lot of courage to speak in front of such a large crowd.",
+      u"Tapang\nKasingkahulugan: bravery, fortitude, valor\nKasalungat: fear, cowardice, timidity\nHalimbawa: Kinailangan ng malaking tapang para magsalita sa harap ng malaking madla." },
+    { u"Cynical",
+      u"His cynical attitude made it hard for him to believe in others' goodwill.",
+      { u"distrustful", u"skeptical", u"doubtful" },
+      { u"trusting", u"hopeful", u"optimistic" },
+      u"Origin: Greek 'kynikos', dog-like",
+      u"In context, 'Cynical' can be used like this: His cynical attitude made it hard for him to believe in others' goodwill.",
+      u"Mapangduda\nKasingkahulugan: distrustful, skeptical, doubtful\nKasalungat: trusting, hopeful, optimistic\nHalimbawa: Dahil sa kanyang mapangdudang ugali, hirap siyang maniwala sa kabutihan ng iba." },
+    { u"Compassionate",
+      u"She was a compassionate nurse who always took extra time with her patients.",
+      { u"empathetic", u"kind", u"caring" },
+      { u"indifferent", u"apathetic", u"callous" },
+      u"Origin: Latin 'compassio', to suffer with",
+      u"In context, 'Compassionate' can be used like this: She was a compassionate nurse who always took extra time with her patients.",
+      u"Maawain\nKasingkahulugan: empathetic, kind, caring\nKasalungat: indifferent, apathetic, callous\nHalimbawa: Siya ay isang maawain na nars na laging nagbibigay ng oras sa mga pasyente." },
+    { u"Confident",
+      u"She walked into the meeting with a confident attitude.",
+      { u"self-assured", u"assertive", u"positive" },
+      { u"insecure", u"uncertain", u"unsure" },
+      u"Origin: Latin 'confidere', to trust",
+      u"In context, 'Confident' can be used like this: She walked into the meeting with a confident attitude.",
+      u"May Kumpiyansa\nKasingkahulugan: self-assured, assertive, positive\nKasalungat: insecure, uncertain, unsure\nHalimbawa: Lumakad siya sa pulong nang may kumpiyansang ugali." },
+    { u"Complacent",
+      u"He became complacent after achieving success and stopped working hard.",
+      { u"self-satisfied", u"content", u"untroubled" },
+      { u"ambitious", u"dissatisfied", u"restless" },
+      u"Origin: Latin 'complacere', to please",
+      u"In context, 'Complacent' can be used like this: He became complacent after achieving success and stopped working hard.",
+      u"Kuntento sa Sarili\nKasingkahulugan: self-satisfied, content, untroubled\nKasalungat: ambitious, dissatisfied, restless\nHalimbawa: Naging kampante siya matapos magtagumpay at tumigil sa pagsisikap." },
+    { u"Chaotic",
+      u"The streets were chaotic after the parade, with people everywhere.",
+      { u"disorderly", u"tumultuous", u"confusing" },
+      { u"orderly", u"organized", u"calm" },
+      u"Origin: Greek 'chaos'",
+      u"In context, 'Chaotic' can be used like this: The streets were chaotic after the parade, with people everywhere.",
+      u"Magulo\nKasingkahulugan: disorderly, tumultuous, confusing\nKasalungat: orderly, organized, calm\nHalimbawa: Magulo ang mga kalsada matapos ang parada, puno ng tao sa lahat ng dako." },
+    { u"Cumbersome",
+      u"The cumbersome package was hard to carry up the stairs.",
+      { u"awkward", u"unwieldy", u"bulky" },
+      { u"manageable", u"easy", u"simple" },
+      u"Origin: Old Norse/Old English roots relating to burden",
+      u"In context, 'Cumbersome' can be used like this: The cumbersome package was hard to carry up the stairs.",
+      u"Mabigat Dalhin\nKasingkahulugan: awkward, unwieldy, bulky\nKasalungat: manageable, easy, simple\nHalimbawa: Ang mabigat na pakete ay mahirap buhatin paakyat ng hagdan." },
+    { u"Cautiously",
+      u"He moved cautiously around the broken glass on the floor.",
+      { u"carefully", u"warily", u"prudently" },
+      { u"recklessly", u"hastily", u"carelessly" },
+      u"Adverbial form of cautious",
+      u"In context, 'Cautiously' can be used like this: He moved cautiously around the broken glass on the floor.",
+      u"Maingat na Paraan\nKasingkahulugan: carefully, warily, prudently\nKasalungat: recklessly, hastily, carelessly\nHalimbawa: Maingat siyang gumalaw sa paligid ng nabasag na baso sa sahig." },
+    { u"Crucial",
+      u"It is crucial to follow the safety instructions when operating heavy machinery.",
+      { u"critical", u"vital", u"essential" },
+      { u"trivial", u"insignificant", u"unimportant" },
+      u"Origin: Greek 'krisis', decisive moment",
+      u"In context, 'Crucial' can be used like this: It is crucial to follow the safety instructions when operating heavy machinery.",
+      u"Mahalaga\nKasingkahulugan: critical, vital, essential\nKasalungat: trivial, insignificant, unimportant\nHalimbawa: Mahalagang sundin ang mga panuntunan sa kaligtasan kapag gumagamit ng mabigat na makina." },
+    { u"Cleverness",
+      u"Her cleverness in solving the riddle impressed everyone at the party.",
+      { u"ingenuity", u"intelligence", u"wit" },
+      { u"stupidity", u"dullness", u"clumsiness" },
+      u"Abstract noun from clever",
+      u"In context, 'Cleverness' can be used like this: Her cleverness in solving the riddle impressed everyone at the party.",
+      u"Katalinuhan\nKasingkahulugan: ingenuity, intelligence, wit\nKasalungat: stupidity, dullness, clumsiness\nHalimbawa: Ang kanyang katalinuhan sa paglutas ng palaisipan ay ikinamangha ng lahat." },
+    { u"Conservative",
+      u"The conservative approach to the project emphasized safety and stability.",
+      { u"traditional", u"cautious", u"conventional" },
+      { u"liberal", u"progressive", u"radical" },
+      u"Origin: Latin 'conservare', to preserve",
+      u"In context, 'Conservative' can be used like this: The conservative approach to the project emphasized safety and stability.",
+      u"Konserbatibo\nKasingkahulugan: traditional, cautious, conventional\nKasalungat: liberal, progressive, radical\nHalimbawa: Ang konserbatibong paraan ng proyekto ay nakatuon sa kaligtasan at katatagan." },
+    { u"Contradictory",
+      u"His contradictory statements left everyone confused about his true intentions.",
+      { u"inconsistent", u"conflicting", u"opposing" },
+      { u"consistent", u"harmonious", u"matching" },
+      u"From contra- + dictate, opposing",
+      u"In context, 'Contradictory' can be used like this: His contradictory statements left everyone confused about his true intentions.",
+      u"Magkasalungat\nKasingkahulugan: inconsistent, conflicting, opposing\nKasalungat: consistent, harmonious, matching\nHalimbawa: Ang kanyang magkasalungat na pahayag ay nagdulot ng kalituhan." },
+    { u"Crisis",
+      u"The company faced a crisis after a major financial loss.",
+      { u"emergency", u"disaster", u"catastrophe" },
+      { u"solution", u"recovery", u"resolution" },
+      u"Origin: Greek 'krisis', decision",
+      u"In context, 'Crisis' can be used like this: The company faced a crisis after a major financial loss.",
+      u"Krisis\nKasingkahulugan: emergency, disaster, catastrophe\nKasalungat: solution, recovery, resolution\nHalimbawa: Nakaranas ng krisis ang kumpanya matapos ang malaking pagkalugi." },
+    { u"Competent",
+      u"She is a highly competent manager who always gets the job done.",
+      { u"capable", u"skilled", u"proficient" },
+      { u"incompetent", u"unskilled", u"inept" },
+      u"From Latin 'competentia'",
+      u"In context, 'Competent' can be used like this: She is a highly competent manager who always gets the job done.",
+      u"Magaling\nKasingkahulugan: capable, skilled, proficient\nKasalungat: incompetent, unskilled, inept\nHalimbawa: Isa siyang mahusay na tagapamahala na laging natatapos ang gawain." },
+    { u"Crude",
+      u"His crude humor made some people uncomfortable at the dinner table.",
+      { u"unrefined", u"rough", u"vulgar" },
+      { u"refined", u"sophisticated", u"polite" },
+      u"Origin: Old English 'cruden', raw",
+      u"In context, 'Crude' can be used like this: His crude humor made some people uncomfortable at the dinner table.",
+      u"Bastos\nKasingkahulugan: unrefined, rough, vulgar\nKasalungat: refined, sophisticated, polite\nHalimbawa: Ang kanyang bastos na biro ay naka-offend sa ilan sa hapag-kainan." },
+    { u"Calm",
+      u"The calm waters of the lake reflected the evening sky beautifully.",
+      { u"peaceful", u"serene", u"composed" },
+      { u"agitated", u"nervous", u"anxious" },
+      u"Origin: Old English 'calm', tranquil",
+      u"In context, 'Calm' can be used like this: The calm waters of the lake reflected the evening sky beautifully.",
+      u"Kalma\nKasingkahulugan: peaceful, serene, composed\nKasalungat: agitated, nervous, anxious\nHalimbawa: Ang kalmadong tubig ng lawa ay maganda sa ilalim ng langit sa gabi." },
+    { u"Cleverly",
+      u"He cleverly avoided the question by changing the topic.",
+      { u"intelligently", u"wittily", u"astutely" },
+      { u"foolishly", u"ineptly", u"clumsily" },
+      u"Adverbial form of clever",
+      u"In context, 'Cleverly' can be used like this: He cleverly avoided the question by changing the topic.",
+      u"Matalinong Paraan\nKasingkahulugan: intelligently, wittily, astutely\nKasalungat: foolishly, ineptly, clumsily\nHalimbawa: Matalino niyang naiwasan ang tanong sa pamamagitan ng pagbabago ng paksa." },
+    { u"Culminate",
+      u"The event will culminate with a grand fireworks display.",
+      { u"conclude", u"finish", u"climax" },
+      { u"begin", u"initiate", u"start" },
+      u"From Latin 'culminare', to summit",
+      u"In context, 'Culminate' can be used like this: The event will culminate with a grand fireworks display.",
+      u"Umuabot sa Sukdulan\nKasingkahulugan: conclude, finish, climax\nKasalungat: begin, initiate, start\nHalimbawa: Ang kaganapan ay magtatapos sa isang engrandeng paputok." },
+    { u"Challenging",
+      u"The math problem was challenging, but she solved it after a few tries.",
+      { u"difficult", u"demanding", u"tough" },
+      { u"easy", u"simple", u"effortless" },
+      u"Modern English usage",
+      u"In context, 'Challenging' can be used like this: The math problem was challenging, but she solved it after a few tries.",
+      u"Mahamon\nKasingkahulugan: difficult, demanding, tough\nKasalungat: easy, simple, effortless\nHalimbawa: Mahirap ang problema sa math, pero nalutas niya pagkatapos ng ilang ulit." },
+    { u"Corrupt",
+      u"The corrupt officials were arrested after an investigation uncovered their crimes.",
+      { u"dishonest", u"immoral", u"depraved" },
+      { u"honest", u"virtuous", u"moral" },
+      u"From Latin 'corrumpere', to destroy",
+      u"In context, 'Corrupt' can be used like this: The corrupt officials were arrested after an investigation uncovered their crimes.",
+      u"Tiwali\nKasingkahulugan: dishonest, immoral, depraved\nKasalungat: honest, virtuous, moral\nHalimbawa: Ang mga tiwaling opisyal ay nahuli matapos ang masusing imbestigasyon." },
+    { u"Conducive",
+      u"The quiet room was conducive to studying and concentration.",
+      { u"favorable", u"helpful", u"advantageous" },
+      { u"harmful", u"obstructive", u"detrimental" },
+      u"From Latin 'conducere', to lead together",
+      u"In context, 'Conducive' can be used like this: The quiet room was conducive to studying and concentration.",
+      u"Nakakatulong\nKasingkahulugan: favorable, helpful, advantageous\nKasalungat: harmful, obstructive, detrimental\nHalimbawa: Ang tahimik na silid ay nakakatulong sa pag-aaral at konsentrasyon." },
+    { u"Contentious",
+      u"The meeting became contentious as both sides refused to compromise.",
+      { u"argumentative", u"controversial", u"combative" },
+      { u"agreeable", u"peaceful", u"harmonious" },
+      u"From Latin 'contentio', dispute",
+      u"In context, 'Contentious' can be used like this: The meeting became contentious as both sides refused to compromise.",
+      u"Mapagtalo\nKasingkahulugan: argumentative, controversial, combative\nKasalungat: agreeable, peaceful, harmonious\nHalimbawa: Naging mainit ang pagtatalo dahil parehong ayaw magpatalo ang magkabilang panig." },
+    { u"Complicated",
+      u"The complicated instructions confused everyone trying to assemble the furniture.",
+      { u"complex", u"intricate", u"convoluted" },
+      { u"simple", u"straightforward", u"clear" },
+      u"From Latin 'complicare', to fold together",
+      u"In context, 'Complicated' can be used like this: The complicated instructions confused everyone trying to assemble the furniture.",
+      u"Kumplikado\nKasingkahulugan: complex, intricate, convoluted\nKasalungat: simple, straightforward, clear\nHalimbawa: Nalito ang lahat sa komplikadong tagubilin sa pagbuo ng muwebles." },
+    { u"Critical",
+      u"Your critical feedback helped improve the quality of the final report.",
+      { u"essential", u"crucial", u"urgent" },
+      { u"insignificant", u"trivial", u"unimportant" },
+      u"From Greek 'kritikos', able to judge",
+      u"In context, 'Critical' can be used like this: Your critical feedback helped improve the quality of the final report.",
+      u"Kritikal\nKasingkahulugan: essential, crucial, urgent\nKasalungat: insignificant, trivial, unimportant\nHalimbawa: Ang iyong kritikal na puna ay nakatulong sa pagpapabuti ng ulat." },
+    { u"Credible",
+      u"The journalist gave a credible account of the events that took place.",
+      { u"believable", u"reliable", u"trustworthy" },
+      { u"unbelievable", u"unreliable", u"dubious" },
+      u"From Latin 'credibilis', believable",
+      u"In context, 'Credible' can be used like this: The journalist gave a credible account of the events that took place.",
+      u"Mapagkakatiwalaan\nKasingkahulugan: believable, reliable, trustworthy\nKasalungat: unbelievable, unreliable, dubious\nHalimbawa: Nagbigay ang mamamahayag ng kapanipaniwalang salaysay ng mga pangyayari." },
+    { u"Clarity",
+      u"The clarity of her explanation made the complex concept easy to understand.",
+      { u"clearness", u"precision", u"transparency" },
+      { u"confusion", u"ambiguity", u"vagueness" },
+      u"From Latin 'claritas', brightness",
+      u"In context, 'Clarity' can be used like this: The clarity of her explanation made the complex concept easy to understand.",
+      u"Kalinawan\nKasingkahulugan: clearness, precision, transparency\nKasalungat: confusion, ambiguity, vagueness\nHalimbawa: Dahil sa linaw ng kanyang paliwanag, madali nilang naintindihan ang konsepto." },
+    { u"Crowded",
+      u"The subway was crowded during rush hour, making it difficult to move.",
+      { u"packed", u"congested", u"jammed" },
+      { u"empty", u"spacious", u"vacant" },
+      u"Common modern English",
+      u"In context, 'Crowded' can be used like this: The subway was crowded during rush hour, making it difficult to move.",
+      u"Matao\nKasingkahulugan: packed, congested, jammed\nKasalungat: empty, spacious, vacant\nHalimbawa: Matao sa tren tuwing rush hour kaya hirap gumalaw." },
+    { u"Circular",
+      u"The park had a circular walking path that looped around the lake.",
+      { u"round", u"ring-shaped", u"annular" },
+      { u"square", u"rectangular", u"angular" },
+      u"From Latin 'circulus', small ring",
+      u"In context, 'Circular' can be used like this: The park had a circular walking path that looped around the lake.",
+      u"Bilog\nKasingkahulugan: round, ring-shaped, annular\nKasalungat: square, rectangular, angular\nHalimbawa: May paikot na daanan sa parke na pumapalibot sa lawa." },
+    { u"Cuddly",
+      u"The cuddly kitten purred as it curled up in my lap.",
+      { u"soft", u"huggable", u"snuggly" },
+      { u"rough", u"stiff", u"uninviting" },
+      u"Colloquial usage",
+      u"In context, 'Cuddly' can be used like this: The cuddly kitten purred as it curled up in my lap.",
+      u"Malambing\nKasingkahulugan: soft, huggable, snuggly\nKasalungat: rough, stiff, uninviting\nHalimbawa: Ang malambing na kuting ay umidlip sa aking kandungan." },
+    { u"Clamorous",
+      u"The clamorous crowd cheered as the team scored the winning goal.",
+      { u"noisy", u"loud", u"boisterous" },
+      { u"quiet", u"peaceful", u"subdued" },
+      u"From Latin 'clamor', a shout",
+      u"In context, 'Clamorous' can be used like this: The clamorous crowd cheered as the team scored the winning goal.",
+      u"Maingay\nKasingkahulugan: noisy, loud, boisterous\nKasalungat: quiet, peaceful, subdued\nHalimbawa: Sigawan ang narinig mula sa maingay na karamihan matapos manalo ang koponan." },
+    { u"Cold",
+      u"The cold wind made it feel like winter even though it was still autumn.",
+      { u"chilly", u"frigid", u"icy" },
+      { u"warm", u"hot", u"toasty" },
+      u"Old English 'cald'",
+      u"In context, 'Cold' can be used like this: The cold wind made it feel like winter even though it was still autumn.",
+      u"Malamig\nKasingkahulugan: chilly, frigid, icy\nKasalungat: warm, hot, toasty\nHalimbawa: Ang malamig na hangin ay nagparamdam ng taglamig kahit taglagas pa." },
+    { u"Capable",
+      u"She is capable of handling complex tasks under pressure.",
+      { u"competent", u"skilled", u"able" },
+      { u"incompetent", u"incapable", u"unfit" },
+      u"From Latin 'capax', able to contain",
+      u"In context, 'Capable' can be used like this: She is capable of handling complex tasks under pressure.",
+      u"May Kakayahan\nKasingkahulugan: competent, skilled, able\nKasalungat: incompetent, incapable, unfit\nHalimbawa: Marunong siyang humawak ng mahihirap na gawain kahit may pressure." },
+    { u"Captive",
+      u"The animals in the zoo were captive, unable to roam free in the wild.",
+      { u"imprisoned", u"confined", u"enslaved" },
+      { u"free", u"liberated", u"independent" },
+      u"From Latin 'captivus', taken",
+      u"In context, 'Captive' can be used like this: The animals in the zoo were captive, unable to roam free in the wild.",
+      u"Bilanggo\nKasingkahulugan: imprisoned, confined, enslaved\nKasalungat: free, liberated, independent\nHalimbawa: Ang mga hayop sa zoo ay bilanggo at hindi makagala sa kagubatan." },
+    { u"Clear",
+      u"The instructions were clear, and everyone understood what to do.",
+      { u"obvious", u"evident", u"transparent" },
+      { u"unclear", u"ambiguous", u"opaque" },
+      u"From Old English 'cleare'",
+      u"In context, 'Clear' can be used like this: The instructions were clear, and everyone understood what to do.",
+      u"Malinaw\nKasingkahulugan: obvious, evident, transparent\nKasalungat: unclear, ambiguous, opaque\nHalimbawa: Malinaw ang mga tagubilin kaya lahat ay nakasunod." },
+    { u"Charitable",
+      u"The charitable organization helps provide food and shelter for the homeless.",
+      { u"generous", u"kind", u"benevolent" },
+      { u"selfish", u"greedy", u"stingy" },
+      u"From Latin 'caritas', charity",
+      u"In context, 'Charitable' can be used like this: The charitable organization helps provide food and shelter for the homeless.",
+      u"Mapagbigay\nKasingkahulugan: generous, kind, benevolent\nKasalungat: selfish, greedy, stingy\nHalimbawa: Ang mapagbigay na organisasyon ay tumutulong sa mga walang tirahan." },
+    { u"Content",
+      u"After a long day of work, he felt content sitting on the couch.",
+      { u"satisfied", u"pleased", u"happy" },
+      { u"dissatisfied", u"unhappy", u"discontent" },
+      u"From Latin 'contentus', satisfied",
+      u"In context, 'Content' can be used like this: After a long day of work, he felt content sitting on the couch.",
+      u"Kuntento\nKasingkahulugan: satisfied, pleased, happy\nKasalungat: dissatisfied, unhappy, discontent\nHalimbawa: Pagkatapos ng buong araw ng trabaho, kuntento siyang naupo sa sofa." },
+    { u"Conserve",
+      u"We need to conserve water during the drought to avoid shortages.",
+      { u"preserve", u"protect", u"save" },
+      { u"waste", u"squander", u"deplete" },
+      u"From Latin 'conservare'",
+      u"In context, 'Conserve' can be used like this: We need to conserve water during the drought to avoid shortages.",
+      u"Magtipid\nKasingkahulugan: preserve, protect, save\nKasalungat: waste, squander, deplete\nHalimbawa: Kailangang magtipid ng tubig sa panahon ng tagtuyot." },
+    { u"Commendable",
+      u"Her commendable efforts to reduce waste in the office were recognized by management.",
+      { u"praiseworthy", u"admirable", u"laudable" },
+      { u"disreputable", u"dishonorable", u"blameworthy" },
+      u"From Latin 'commendare', to entrust",
+      u"In context, 'Commendable' can be used like this: Her commendable efforts to reduce waste in the office were recognized by management.",
+      u"Kapuri-puri\nKasingkahulugan: praiseworthy, admirable, laudable\nKasalungat: disreputable, dishonorable, blameworthy\nHalimbawa: Ang kanyang kapuri-puring pagsisikap na bawasan ang basura ay napansin ng pamunuan." },
+    { u"Composed",
+      u"Despite the chaos around her, she remained composed and kept working.",
+      { u"calm", u"collected", u"serene" },
+      { u"agitated", u"nervous", u"stressed" },
+      u"From Latin 'componere', to put together",
+      u"In context, 'Composed' can be used like this: Despite the chaos around her, she remained composed and kept working.",
+      u"Kalma\nKasingkahulugan: calm, collected, serene\nKasalungat: agitated, nervous, stressed\nHalimbawa: Sa kabila ng kaguluhan, nanatili siyang kalmado at nagpatuloy sa trabaho." },
+};
+
+#endif // SEED_WORDS_H
@@ -0,0 +1,244 @@
+#include "Word_Files/Text_Index.h"
+#include "Word_Files/Word_Storage.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <queue>
+
+namespace {
+// BM25 parameters and per-field boosts. The definition is what users search
+// for most, so it outweighs the example sentence and the etymology.
+const double K1 = 1.2;
+const double B = 0.75;
+const double FIELD_BOOST[TextIndex::FieldCount] = { 2.0, 1.0, 0.5 };
+
+// Blocks of a stored index: the totals, the lengths by id, the postings.
+enum StoredBlock { Totals, LengthsBlock, PostingsBlock, StoredBlockCount };
+}
+
+QStringList TextIndex::tokenize(const QString &text)
+{
+    QStringList out;
+    int start = -1;
+    for (int i = 0; i <= text.size(); ++i) {
+        const bool inWord = i < text.size() && text.at(i).isLetterOrNumber();
+        if (inWord && start < 0) {
+            start = i;
+        } else if (!inWord && start >= 0) {
+            out.append(text.mid(start, i - start).toCaseFolded());
+            start = -1;
+        }
+    }
+    return out;
+}
+
+void TextIndex::clear()
+{
+    m_postings.clear();
+    m_lengths.clear();
+    m_totalLengths.fill(0);
+    m_docCount = 0;
+    m_basePostings.detach();
+    m_baseLengths = nullptr;
+    m_baseCount = 0;
+}
+
+bool TextIndex::attach(const MappedBlock &block)
+{
+    clear();
+    MappedBlockSet set;
+    if (!set.attach(block) || set.count() != StoredBlockCount) return false;
+
+    // Totals: the token count of each field, then the number of entries.
+    const qint64 *totals = set.block(Totals).array<qint64>(FieldCount + 1);
+    if (!totals || totals[FieldCount] < 0 || totals[FieldCount] > INT_MAX) return false;
+    const int count = int(totals[FieldCount]);
+    const Lengths *lengths = set.block(LengthsBlock).array<Lengths>(quint64(count));
+    if (!lengths || !m_basePostings.attach(set.block(PostingsBlock))) {
+        m_basePostings.detach();
+        return false;
+    }
+
+    m_baseLengths = lengths;
+    m_baseCount = count;
+    m_docCount = count;
+    for (int f = 0; f < FieldCount; ++f) m_totalLengths[f] = totals[f];
+    return true;
+}
+
+QByteArray TextIndex::serialize() const
+{
+    Q_ASSERT(m_baseCount == 0);
+    qint64 totals[FieldCount + 1];
+    for (int f = 0; f < FieldCount; ++f) totals[f] = m_totalLengths[f];
+    totals[FieldCount] = m_lengths.size();
+
+    QVector<QPair<QString, QVector<Posting>>> postings;
+    postings.reserve(m_postings.size());
+    for (auto it = m_postings.constBegin(); it != m_postings.constEnd(); ++it) {
+        postings.append(qMakePair(it.key(), it.value()));
+    }
+    std::sort(postings.begin(), postings.end(),
+              [](const auto &a, const auto &b) { return a.first < b.first; });
+
+    return MappedBlockSet::serialize({
+        MappedBlockSet::fromArray(totals, FieldCount + 1),
+        MappedBlockSet::fromArray(m_lengths.constData(), m_lengths.size()),
+        MappedTable<Posting>::serialize(postings),
+    });
+}
+
+const TextIndex::Lengths &TextIndex::lengths(int id) const
+{
+    // Ids come from postings, which a corrupt snapshot could get wrong.
+    static const Lengths none{};
+    if (id < 0 || id >= m_baseCount + m_lengths.size()) return none;
+    return id < m_baseCount ? m_baseLengths[id] : m_lengths.at(id - m_baseCount);
+}
+
+void TextIndex::add(int id, const WordEntry &entry)
+{
+    const QString *fields[FieldCount] = { &entry.definition, &entry.usage, &entry.background };
+
+    // Count every term per field first so each entry gets one posting per term.
+    QHash<QString, std::array<quint16, FieldCount>> counts;
+    std::array<quint16, FieldCount> lengths{};
+    for (int f = 0; f < FieldCount; ++f) {
+        const QStringList terms = tokenize(*fields[f]);
+        lengths[f] = quint16(qMin(terms.size(), qsizetype(0xFFFF)));
+        for (const QString &term : terms) {
+            auto &tf = counts[term];
+            if (tf[f] < 0xFFFF) ++tf[f];
+        }
+    }
+
+    for (auto it = counts.constBegin(); it != counts.constEnd(); ++it) {
+        m_postings[it.key()].append(Posting{id, it.value()});
+    }
+
+    const int slot = id - m_baseCount;
+    if (m_lengths.size() <= slot) m_lengths.resize(slot + 1);
+    m_lengths[slot] = lengths;
+    for (int f = 0; f < FieldCount; ++f) m_totalLengths[f] += lengths[f];
+    ++m_docCount;
+}
+
+QVector<TextIndex::PostingList> TextIndex::postingsFor(const QString &query) const
+{
+    QStringList terms = tokenize(query);
+    terms.removeDuplicates();
+
+    QVector<PostingList> lists;
+    lists.reserve(terms.size());
+    for (const QString &term : terms) {
+        PostingList list;
+        list.base = m_basePostings.values(term);
+        auto it = m_postings.constFind(term);
+        if (it != m_postings.constEnd()) list.added = &it.value();
+        if (list.size() == 0) return {};
+        lists.append(list);
+    }
+
+    // Intersecting from the rarest term keeps the running result small.
+    std::sort(lists.begin(), lists.end(), [](const PostingList &a, const PostingList &b) {
+        return a.size() < b.size();
+    });
+    return lists;
+}
+
+QVector<int> TextIndex::intersect(const QVector<PostingList> &lists)
+{
+    QVector<int> result;
+    if (lists.isEmpty()) return result;
+
+    const PostingList &rarest = lists.first();
+    result.reserve(rarest.size());
+    for (int k = 0; k < rarest.size(); ++k) result.append(rarest.at(k).id);
+
+    for (int i = 1; i < lists.size() && !result.isEmpty(); ++i) {
+        QVector<int> next;
+        const PostingList &list = lists.at(i);
+        int pos = 0;
+        for (int id : result) {
+            // Binary search for the first posting at or after `id`.
+            int end = list.size();
+            while (pos < end) {
+                const int mid = pos + (end - pos) / 2;
+                if (list.at(mid).id < id) pos = mid + 1;
+                else end = mid;
+            }
+            if (pos == list.size()) break;
+            if (list.at(pos).id == id) next.append(id);
+        }
+        result = next;
+    }
+    return result;
+}
+
+QVector<int> TextIndex::query(const QString &query) const
+{
+    return intersect(postingsFor(query));
+}
+
+QVector<QPair<int, double>> TextIndex::rank(const QString &query, int k) const
+{
+    QVector<QPair<int, double>> out;
+    if (k <= 0 || m_docCount == 0) return out;
+
+    const auto lists = postingsFor(query);
+    const QVector<int> candidates = intersect(lists);
+    if (candidates.isEmpty()) return out;
+
+    double avgLength[FieldCount];
+    for (int f = 0; f < FieldCount; ++f) {
+        avgLength[f] = qMax(1.0, double(m_totalLengths[f]) / m_docCount);
+    }
+
+    QVector<double> idf;
+    idf.reserve(lists.size());
+    for (const PostingList &list : lists) {
+        const double df = list.size();
+        idf.append(std::log(1.0 + (m_docCount - df + 0.5) / (df + 0.5)));
+    }
+
+    // Candidates are ascending, so one forward cursor per posting list finds
+    // every term frequency in a single pass.
+    QVector<int> cursors(lists.size(), 0);
+
+    // Min-heap on score holding the best k candidates seen so far.
+    using Scored = QPair<double, int>;
+    std::priority_queue<Scored, std::vector<Scored>, std::greater<Scored>> heap;
+
+    for (int id : candidates) {
+        const Lengths &lengths = this->lengths(id);
+        double score = 0.0;
+        for (int t = 0; t < lists.size(); ++t) {
+            int &cur = cursors[t];
+            while (cur < lists.at(t).size() && lists.at(t).at(cur).id < id) ++cur;
+            if (cur == lists.at(t).size()) continue;
+            const Posting &posting = lists.at(t).at(cur);
+            for (int f = 0; f < FieldCount; ++f) {
+                const double tf = posting.tf[f];
+                if (tf == 0) continue;
+                const double norm = K1 * (1.0 - B + B * lengths[f] / avgLength[f]);
+                score += idf.at(t) * FIELD_BOOST[f] * tf * (K1 + 1.0) / (tf + norm);
+            }
+        }
+
+        if (int(heap.size()) < k) {
+            heap.push(Scored(score, id));
+        } else if (score > heap.top().first) {
+            heap.pop();
+            heap.push(Scored(score, id));
+        }
+    }
+
+    out.resize(int(heap.size()));
+    for (int i = out.size() - 1; i >= 0; --i) {
+        out[i] = qMakePair(heap.top().second, heap.top().first);
+        heap.pop();
+    }
+    return out;
+}
@@ -0,0 +1,88 @@
+#ifndef TEXT_INDEX_H
+#define TEXT_INDEX_H
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QHash>
+#include <QPair>
+#include <QByteArray>
+#include <array>
+#include "Word_Files/Mapped_Table.h"
+
+struct WordEntry;
+
+// Inverted index over the free-text fields of a WordEntry
+// (definition, usage and background): term -> ascending list of postings.
+// Per-field term frequencies and lengths are kept so results can be ranked
+// with BM25 without touching the entries themselves.
+//
+// The index of a dictionary snapshot is stored in it (serialize()) and read
+// in place from the mapping (attach()); entries added after it are indexed
+// in memory and follow the snapshot's ids.
+class TextIndex {
+public:
+    enum Field { Definition, Usage, Background, FieldCount };
+
+    void clear();
+
+    // Indexes one entry. Ids must be added in ascending order so posting
+    // lists stay sorted without any extra work.
+    void add(int id, const WordEntry &entry);
+
+    // Starts from the index stored in a snapshot, covering ids
+    // [0, its entry count). Must be called on an empty index. Returns false,
+    // leaving the index empty, if the block does not hold one.
+    bool attach(const MappedBlock &block);
+
+    // Encodes the index for attach(). Only an index that was filled by add()
+    // alone can be stored.
+    QByteArray serialize() const;
+
+    // Ids of the entries containing every term of `query`, ascending.
+    QVector<int> query(const QString &query) const;
+
+    // The `k` best matches of `query` as (id, score), highest score first.
+    // Candidates are the entries containing every term; they are scored with
+    // per-field BM25 and kept in a bounded heap, so there is no full sort.
+    QVector<QPair<int, double>> rank(const QString &query, int k) const;
+
+    // Splits text into case-folded letter/digit runs.
+    static QStringList tokenize(const QString &text);
+
+private:
+    using Lengths = std::array<quint16, FieldCount>;
+
+    struct Posting {
+        int id;
+        Lengths tf; // term frequency per field
+    };
+
+    // Postings of one term: the stored ones, then the ones added since, so
+    // the ids ascend across both.
+    struct PostingList {
+        MappedTable<Posting>::Run base;
+        const QVector<Posting> *added = nullptr;
+
+        int size() const { return base.size + (added ? int(added->size()) : 0); }
+        const Posting &at(int i) const { return i < base.size ? base.at(i) : added->at(i - base.size); }
+    };
+
+    // Posting lists for the distinct terms of `query`, rarest first, or an
+    // empty list if any term is unknown.
+    QVector<PostingList> postingsFor(const QString &query) const;
+    static QVector<int> intersect(const QVector<PostingList> &lists);
+    const Lengths &lengths(int id) const;
+
+    QHash<QString, QVector<Posting>> m_postings;
+    QVector<Lengths> m_lengths; // tokens per field, by id - m_baseCount
+    std::array<qint64, FieldCount> m_totalLengths{};
+    int m_docCount = 0;
+
+    // Stored index of the snapshot ids [0, m_baseCount).
+    MappedTable<Posting> m_basePostings;
+    const Lengths *m_baseLengths = nullptr;
+    int m_baseCount = 0;
+};
+
+#endif // TEXT_INDEX_H
@@ -0,0 +1,116 @@
+#include "Word_Files/Translation_Index.h"
+#include "Word_Files/Word_Storage.h"
+#include "Word_Files/Text_Index.h"
+#include <algorithm>
+
+Translation Translation::parse(const QString &text)
+{
+    Translation t;
+    if (text.isEmpty()) return t;
+
+    auto splitList = [](const QString &s) {
+        QStringList out;
+        for (const QString &p : s.split(',', Qt::SkipEmptyParts)) {
+            const QString v = p.trimmed();
+            if (!v.isEmpty()) out.append(v);
+        }
+        return out;
+    };
+
+    QStringList pending;
+    for (const QString &ln : text.split('\n', Qt::SkipEmptyParts)) {
+        const QString L = ln.trimmed();
+        if (L.startsWith("Kasingkahulugan", Qt::CaseInsensitive)) {
+            t.synonyms = splitList(L.section(':', 1));
+        } else if (L.startsWith("Kasalungat", Qt::CaseInsensitive)) {
+            t.antonyms = splitList(L.section(':', 1));
+        } else if (L.startsWith("Halimbawa", Qt::CaseInsensitive)) {
+            t.example = L.section(':', 1).trimmed();
+        } else if (!L.isEmpty()) {
+            pending.append(L);
+        }
+    }
+
+    // The first unlabeled line is the Tagalog word; anything after it is kept as notes.
+    if (!pending.isEmpty()) {
+        t.title = pending.takeFirst();
+        t.notes = pending.join("\n");
+    }
+    return t;
+}
+
+void TranslationIndex::clear()
+{
+    m_titleTerms.clear();
+    m_synonymTerms.clear();
+    m_baseTitleTerms.detach();
+    m_baseSynonymTerms.detach();
+}
+
+bool TranslationIndex::attach(const MappedBlock &block)
+{
+    clear();
+    MappedBlockSet set;
+    if (set.attach(block) && set.count() == 2
+        && m_baseTitleTerms.attach(set.block(0)) && m_baseSynonymTerms.attach(set.block(1))) {
+        return true;
+    }
+    clear();
+    return false;
+}
+
+QByteArray TranslationIndex::serialize() const
+{
+    Q_ASSERT(!m_baseTitleTerms.isAttached());
+    auto table = [](const QHash<QString, QVector<int>> &terms) {
+        QVector<QPair<QString, QVector<qint32>>> rows;
+        rows.reserve(terms.size());
+        for (auto it = terms.constBegin(); it != terms.constEnd(); ++it) rows.append(qMakePair(it.key(), it.value()));
+        std::sort(rows.begin(), rows.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+        return MappedTable<qint32>::serialize(rows);
+    };
+    return MappedBlockSet::serialize({ table(m_titleTerms), table(m_synonymTerms) });
+}
+
+// Stored ids for `key`, then the ones added since.
+QVector<int> TranslationIndex::idsFor(const MappedTable<qint32> &base, const QHash<QString, QVector<int>> &added,
+                                      const QString &key)
+{
+    QVector<int> out;
+    for (qint32 id : base.values(key)) out.append(id);
+    out += added.value(key);
+    return out;
+}
+
+// Indexes a phrase under its whole folded text and under each of its words,
+// so "Alisin (Pawiin)" is found by "alisin" and "pawiin" alike.
+void TranslationIndex::addTerms(QHash<QString, QVector<int>> &terms, const QString &phrase, int id)
+{
+    QStringList keys = TextIndex::tokenize(phrase);
+    keys.prepend(WordStorage::foldKey(phrase.trimmed()));
+    for (const QString &key : keys) {
+        if (key.isEmpty()) continue;
+        QVector<int> &ids = terms[key];
+        if (ids.isEmpty() || ids.last() != id) ids.append(id);
+    }
+}
+
+void TranslationIndex::add(int id, const WordEntry &entry)
+{
+    const Translation t = Translation::parse(entry.translation);
+
+    if (!t.title.isEmpty()) addTerms(m_titleTerms, t.title, id);
+    for (const QString &syn : t.synonyms) addTerms(m_synonymTerms, syn, id);
+}
+
+QVector<int> TranslationIndex::lookup(const QString &tagalog) const
+{
+    const QString key = WordStorage::foldKey(tagalog.trimmed());
+    if (key.isEmpty()) return QVector<int>();
+
+    QVector<int> out = idsFor(m_baseTitleTerms, m_titleTerms, key);
+    for (int id : idsFor(m_baseSynonymTerms, m_synonymTerms, key)) {
+        if (!out.contains(id)) out.append(id);
+    }
+    return out;
+}
@@ -0,0 +1,69 @@
+#ifndef TRANSLATION_INDEX_H
+#define TRANSLATION_INDEX_H
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QHash>
+#include <QByteArray>
+#include "Word_Files/Mapped_Table.h"
+
+struct WordEntry;
+
+// Structured form of the Tagalog `translation` field, which is stored as
+// lines of the form:
+//   <Tagalog word>
+//   Kasingkahulugan: <synonyms>
+//   Kasalungat: <antonyms>
+//   Halimbawa: <example sentence>
+struct Translation {
+    QString title;       // first unlabeled line: the Tagalog word(s)
+    QStringList synonyms;
+    QStringList antonyms;
+    QString example;
+    QString notes;       // any further unlabeled lines
+
+    bool isEmpty() const {
+        return title.isEmpty() && synonyms.isEmpty() && antonyms.isEmpty()
+            && example.isEmpty() && notes.isEmpty();
+    }
+
+    static Translation parse(const QString &text);
+};
+
+// Reverse index from Tagalog words to the English entries they translate.
+// Parsed translations are not kept: the text is a cold field that
+// WordStorage::translation() parses when an entry is opened. The terms of a
+// dictionary snapshot are stored in it and read in place, like TextIndex.
+class TranslationIndex {
+public:
+    void clear();
+
+    // Parses the translation of one entry and indexes its terms.
+    void add(int id, const WordEntry &entry);
+
+    // Starts from the terms stored in a snapshot. Must be called on an empty
+    // index. Returns false, leaving the index empty, if the block does not
+    // hold them.
+    bool attach(const MappedBlock &block);
+
+    // Encodes the index for attach(). Only an index that was filled by add()
+    // alone can be stored.
+    QByteArray serialize() const;
+
+    // Ids of the entries whose translation matches `tagalog`: entries whose
+    // Tagalog title matches come first, then those listing it as a synonym.
+    QVector<int> lookup(const QString &tagalog) const;
+
+private:
+    static void addTerms(QHash<QString, QVector<int>> &terms, const QString &phrase, int id);
+    static QVector<int> idsFor(const MappedTable<qint32> &base, const QHash<QString, QVector<int>> &added,
+                               const QString &key);
+
+    QHash<QString, QVector<int>> m_titleTerms;   // folded Tagalog word -> ids
+    QHash<QString, QVector<int>> m_synonymTerms; // folded Tagalog synonym -> ids
+    MappedTable<qint32> m_baseTitleTerms;        // the same, stored for the snapshot ids
+    MappedTable<qint32> m_baseSynonymTerms;
+};
+
+#endif // TRANSLATION_INDEX_H
@@ -0,0 +1,29 @@
+#include "Word_Files/Word_Change_Feed.h"
+
+// Ids are handed out in increasing order, so the pending inserts always
+// form one range.
+void WordChangeFeed::recordInsert(int id)
+{
+    if (m_reset) return; // the reset covers it
+    if (m_first < 0) m_first = id;
+    m_last = id;
+}
+
+void WordChangeFeed::recordReset()
+{
+    m_reset = true;
+    m_first = m_last = -1;
+}
+
+void WordChangeFeed::flush()
+{
+    if (m_reset) {
+        m_reset = false;
+        emit reset();
+    } else if (m_first >= 0) {
+        const int first = m_first;
+        const int last = m_last;
+        m_first = m_last = -1;
+        emit inserted(first, last);
+    }
+}
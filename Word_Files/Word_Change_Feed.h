@@ -0,0 +1,38 @@
+#ifndef WORD_CHANGE_FEED_H
+#define WORD_CHANGE_FEED_H
+
+#include <QObject>
+
+// Change notifications for WordStorage, so views and caches can apply the
+// difference instead of re-reading the whole dictionary.
+//
+// WordStorage records each change as it happens and the feed emits them when
+// the batch containing them ends: once per mutating call, or once per
+// Batch. Adjacent inserts are merged into one range, and a reset
+// replaces everything else recorded in the same batch. Signals are emitted
+// on the writer thread, after WordStorage::published() already shows the
+// change.
+class WordChangeFeed : public QObject {
+    Q_OBJECT
+public:
+    using QObject::QObject;
+
+    void recordInsert(int id);
+    void recordReset();
+    // Emits and clears what was recorded since the last flush().
+    void flush();
+
+signals:
+    // Entries with ids [first, last] were added.
+    void inserted(int first, int last);
+    // The contents were replaced (load() or insertInitialWords()); ids from
+    // before are no longer valid.
+    void reset();
+
+private:
+    int m_first = -1; // pending inserted range, -1 if none
+    int m_last = -1;
+    bool m_reset = false;
+};
+
+#endif // WORD_CHANGE_FEED_H
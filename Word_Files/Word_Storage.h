@@ -4,8 +4,19 @@
 #include <QString>
 #include <QStringList>
 #include <QVector>
+#include <QHash>
 #include <QJsonObject>
 #include <QJsonArray>
+#include "Word_Files/Prefix_Index.h"
+#include "Word_Files/Text_Index.h"
+#include "Word_Files/Relation_Index.h"
+#include "Word_Files/Translation_Index.h"
+#include "Word_Files/Word_Table.h"
+#include "Word_Files/Word_Change_Feed.h"
+#include <memory>
+#include <functional>
+
+class DictionarySnapshot;
 
 // Structure to hold data for a single word entry.
 struct WordEntry {
@@ -52,23 +63,164 @@ struct WordEntry {
 };
 
 // Singleton class for managing the dictionary's word storage.
+//
+// instance() is the writable store and belongs to one writer thread (the GUI
+// thread after startup). Other threads read through published(): an
+// immutable copy of the whole store. Copies share their containers with the
+// live store until it next changes them, so a copy costs little and the
+// writer pays for the detach on its next mutation. Copies are only made when
+// a reader asks for one after a change, so a run of mutations with no reader
+// in between never detaches anything.
 class WordStorage {
 public:
     static WordStorage &instance();
 
-    bool load(const QString &path = QString("words.json"));
+    // The latest version, for reading from any thread. It never changes;
+    // keep the pointer to see one consistent dictionary across several
+    // lookups. The first call after a change makes the new version; while
+    // the writer is in the middle of a Batch the previous one is returned.
+    // Null before the first load().
+    static std::shared_ptr<const WordStorage> published();
+
+    // Notifications for each completed change to instance(). main() creates
+    // the feed on the GUI thread before anything is loaded.
+    static WordChangeFeed &changes();
+
+    // Groups mutations so readers see all of them or none, and the change
+    // feed reports them together. Without a Batch, every mutating call is
+    // a batch of its own.
+    class Batch {
+    public:
+        explicit Batch(WordStorage &storage) : m_storage(storage) { m_storage.beginBatch(); }
+        ~Batch() { m_storage.endBatch(); }
+        Batch(const Batch &) = delete;
+        Batch &operator=(const Batch &) = delete;
+    private:
+        WordStorage &m_storage;
+    };
+
+    // Called during load() with the work done so far out of `total`
+    // (bytes of words.json, or entries when the snapshot is mapped).
+    using LoadProgress = std::function<void(qint64 done, qint64 total)>;
+
+    bool load(const QString &path = QString("words.json"), const LoadProgress &progress = LoadProgress());
+    // Queues a full snapshot on the PersistenceWorker thread; returns false
+    // only if there is no path to save to.
     bool save(const QString &path = QString());
 
-    void addWord(const WordEntry &entry);
+    // Queues one added entry for the journal next to the dictionary file
+    // (<path>.journal, one JSON object per line). load() replays the journal
+    // and save() folds it into the snapshot, so an add only costs the size
+    // of the new entry instead of a rewrite of the whole dictionary.
+    bool appendToJournal(const WordEntry &entry);
+    QString journalPath() const { return m_path.isEmpty() ? QString() : m_path + ".journal"; }
+
+    // Entries added since the dictionary file was last saved, journaled or
+    // replayed from the journal. save() to the dictionary file clears it;
+    // while it is zero there is nothing to fold in.
+    int unsavedChanges() const { return m_unsaved; }
+
+    // Binary copies of the dictionary file that load() maps instead of
+    // parsing JSON while they are current (see DictionarySnapshot). Each save
+    // writes a new <path>.<serial>.bin instead of replacing the one that is
+    // mapped, since a mapped file cannot be replaced on Windows; load() maps
+    // the newest and removes the others.
+    QString snapshotPath(quint32 serial) const;
+
+    // Returns false if an entry with the same word is already stored.
+    bool addWord(const WordEntry &entry);
+    void addWords(const QVector<WordEntry> &entries);
     QVector<WordEntry> allWords() const;
-    QVector<WordEntry> wordsForLetter(QChar letter) const;
-    bool empty() const { return m_words.isEmpty(); }
+
+    // Ids of the entries whose word starts with `letter` (case-insensitive),
+    // in insertion order. The reference stays valid until the next mutation.
+    const QVector<int> &idsForLetter(QChar letter) const;
+    bool empty() const { return size() == 0; }
     void insertInitialWords();
 
+    // Exact lookup through the case-folded word index.
+    // Returns the id of the matching entry, or -1 if the word is not stored.
+    int find(const QString &word) const;
+
+    // Entry `id`, decoded from the mapped snapshot if it comes from there.
+    // word() and definition() decode only the field they return and only
+    // touch the snapshot's hot tier; entry() also reads the cold fields.
+    WordEntry entry(int id) const;
+    QString word(int id) const;
+    QString definition(int id) const;
+
+    // Up to `limit` ids whose word starts with `prefix` (case-insensitive),
+    // in alphabetical order.
+    QVector<int> complete(const QString &prefix, int limit) const;
+
+    // Up to `limit` ids whose word is within `maxDistance` edits of `word`,
+    // closest first. Used for "Did you mean" suggestions on a miss.
+    QVector<int> suggest(const QString &word, int maxDistance, int limit) const;
+
+    // Ids of the entries whose definition, usage or background contain every
+    // term of `query`, ascending.
+    QVector<int> searchText(const QString &query) const { return m_textIndex.query(query); }
+
+    // The `limit` best full-text matches of `query` as (id, BM25 score),
+    // most relevant first.
+    QVector<QPair<int, double>> rankText(const QString &query, int limit) const { return m_textIndex.rank(query, limit); }
+
+    // Synonym/antonym graph: the links an entry lists (pre-resolved to ids),
+    // the entries that list a given word, and words within `maxHops`
+    // synonym edges of an entry.
+    QVector<RelationIndex::Link> links(int id) const { return m_relations.links(id, entry(id)); }
+    QVector<int> listedBy(const QString &word, RelationIndex::Kind kind) const { return m_relations.listedBy(foldKey(word), kind); }
+    QVector<int> related(int id, int maxHops = 2) const;
+
+    // Tagalog side: the parsed translation of an entry (parsed on demand),
+    // and the entries whose translation matches a Tagalog word.
+    Translation translation(int id) const;
+    QVector<int> findTagalog(const QString &tagalog) const { return m_translations.lookup(tagalog); }
+    int size() const { return snapshotCount() + m_words.size(); }
+
+    // Bumped by every load() and by every call that adds words, and carried
+    // into published versions. Results computed at one generation are valid
+    // for exactly that generation (see QueryCache).
+    quint64 generation() const { return m_generation; }
+
+    // Key used by the word index: case-folded so lookups match
+    // QString::compare(..., Qt::CaseInsensitive).
+    static QString foldKey(const QString &word) { return word.toCaseFolded(); }
+
 private:
     WordStorage() = default;
-    QVector<WordEntry> m_words;
+    WordStorage(const WordStorage &) = default;
+    WordStorage &operator=(const WordStorage &) = delete;
+
+    void beginBatch();
+    void endBatch();
+    bool loadJson(const LoadProgress &progress);
+    bool appendEntry(const WordEntry &entry);
+    void queueSnapshot();
+    QVector<quint32> snapshotSerials() const;
+    void rebuildIndex();
+    void replayJournal();
+    int snapshotCount() const;
+
+    static QChar letterKey(QChar letter) { return letter.toLower(); }
+
+    // Ids [0, snapshotCount()) are served from the mapped snapshot; entries
+    // added after it was made live in m_words with id snapshotCount() + i.
+    std::shared_ptr<const DictionarySnapshot> m_snapshot;
+    WordTable m_words;
+    QHash<QString, int> m_index; // folded word -> id
+    QHash<QChar, QVector<int>> m_letterBuckets; // lower-case first letter -> ids
+    PrefixIndex m_prefixIndex; // sorted folded words for completion
+    TextIndex m_textIndex;     // definition/usage/background terms -> ids
+    RelationIndex m_relations; // synonym/antonym graph
+    TranslationIndex m_translations; // parsed translations, Tagalog -> ids
     QString m_path;
+    quint32 m_mappedSerial = 0;   // serial of the file m_snapshot maps, 0 if none
+    quint32 m_snapshotSerial = 0; // newest serial on disk or queued
+    int m_unsaved = 0; // entries not in the dictionary file yet
+    int m_batchDepth = 0; // open Batch scopes
+    quint64 m_batchGeneration = 0; // m_generation when the outermost Batch began
+    quint64 m_generation = 0;
 };
 
 #endif // WORD_STORAGE_H
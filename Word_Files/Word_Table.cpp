@@ -0,0 +1,90 @@
+#include "Word_Files/Word_Table.h"
+#include "Word_Files/Word_Storage.h"
+
+void WordTable::clear()
+{
+    m_arena.clear();
+    for (auto &column : m_spans) column.clear();
+    m_synonyms.clear();
+    m_antonyms.clear();
+    m_listIds.clear();
+    m_pool.clear();
+    m_poolIds.clear();
+}
+
+void WordTable::reserve(int count)
+{
+    for (auto &column : m_spans) column.reserve(count);
+    m_synonyms.reserve(count);
+    m_antonyms.reserve(count);
+}
+
+void WordTable::squeeze()
+{
+    m_arena.squeeze();
+    for (auto &column : m_spans) column.squeeze();
+    m_synonyms.squeeze();
+    m_antonyms.squeeze();
+    m_listIds.squeeze();
+    m_pool.squeeze();
+    m_poolIds.squeeze();
+}
+
+void WordTable::append(const WordEntry &entry)
+{
+    m_spans[Word].append(store(entry.word));
+    m_spans[Definition].append(store(entry.definition));
+    m_spans[Background].append(store(entry.background));
+    m_spans[Usage].append(store(entry.usage));
+    m_spans[Translation].append(store(entry.translation));
+    m_synonyms.append(intern(entry.synonyms));
+    m_antonyms.append(intern(entry.antonyms));
+}
+
+QString WordTable::text(int row, Column column) const
+{
+    const Span s = m_spans[column].at(row);
+    return m_arena.mid(s.offset, s.length);
+}
+
+WordEntry WordTable::entry(int row) const
+{
+    WordEntry e;
+    e.word = text(row, Word);
+    e.definition = text(row, Definition);
+    e.synonyms = synonyms(row);
+    e.antonyms = antonyms(row);
+    e.background = text(row, Background);
+    e.usage = text(row, Usage);
+    e.translation = text(row, Translation);
+    return e;
+}
+
+WordTable::Span WordTable::store(const QString &value)
+{
+    const Span s{ quint32(m_arena.size()), quint32(value.size()) };
+    m_arena += value;
+    return s;
+}
+
+WordTable::Span WordTable::intern(const QStringList &words)
+{
+    const Span s{ quint32(m_listIds.size()), quint32(words.size()) };
+    for (const QString &w : words) {
+        auto it = m_poolIds.constFind(w);
+        if (it == m_poolIds.constEnd()) {
+            it = m_poolIds.insert(w, quint32(m_pool.size()));
+            m_pool.append(w);
+        }
+        m_listIds.append(it.value());
+    }
+    return s;
+}
+
+QStringList WordTable::list(Span span) const
+{
+    QStringList out;
+    out.reserve(span.length);
+    for (quint32 i = 0; i < span.length; ++i) out.append(m_pool.at(m_listIds.at(span.offset + i)));
+    return out;
+}
@@ -0,0 +1,60 @@
+#ifndef WORD_TABLE_H
+#define WORD_TABLE_H
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QHash>
+
+struct WordEntry;
+
+// Column-oriented store for word entries.
+//
+// Text fields are not kept as one QString per entry: every value is copied
+// into a single UTF-16 arena and each column holds (offset, length) spans
+// into it, so a scan over one column walks one small array. Synonyms and
+// antonyms are interned: each distinct word is stored once in a pool and
+// lists hold 32-bit ids into it, since the same few words recur across
+// thousands of lists.
+//
+// Copies share their data until one of them is modified, so a WordTable can
+// be handed to another thread by value as an immutable snapshot.
+class WordTable {
+public:
+    enum Column { Word, Definition, Background, Usage, Translation, ColumnCount };
+
+    int size() const { return m_spans[Word].size(); }
+    bool isEmpty() const { return size() == 0; }
+    void clear();
+    void reserve(int count);
+    void squeeze();
+
+    void append(const WordEntry &entry);
+
+    QString text(int row, Column column) const;
+    QString word(int row) const { return text(row, Word); }
+    QString definition(int row) const { return text(row, Definition); }
+    QStringList synonyms(int row) const { return list(m_synonyms.at(row)); }
+    QStringList antonyms(int row) const { return list(m_antonyms.at(row)); }
+    WordEntry entry(int row) const;
+
+private:
+    struct Span {
+        quint32 offset;
+        quint32 length;
+    };
+
+    Span store(const QString &value);
+    Span intern(const QStringList &words);
+    QStringList list(Span span) const;
+
+    QString m_arena;                        // every text value, back to back
+    QVector<Span> m_spans[ColumnCount];     // per column: span in m_arena, by row
+    QVector<Span> m_synonyms;               // span in m_listIds, by row
+    QVector<Span> m_antonyms;
+    QVector<quint32> m_listIds;             // pool ids of every list, back to back
+    QVector<QString> m_pool;                // interned list words, by id
+    QHash<QString, quint32> m_poolIds;      // list word -> id in m_pool
+};
+
+#endif // WORD_TABLE_H